@@ -16,8 +16,8 @@ if not exist "built/stereo2.bc" (
 )
 
 
-emcc.bat -s WASM=1 -funroll-loops -Os -O3 -s ASSERTIONS=0 -s SAFE_HEAP=0 -s VERBOSE=0 -fno-rtti -fno-exceptions -Wno-pointer-sign --closure 1 --llvm-lto 1 -I./src  -I./src/stereo  -I./src/stereo/Common  --memory-init-file 0  -s NO_FILESYSTEM=1 built/stereo1.bc  built/stereo2.bc  src/loaders.cpp src/filter.cpp src/filter6581.cpp src/filter8580.cpp src/wavegenerator.cpp src/envelope.cpp src/sid.cpp src/memory.c src/system.cpp src/cpu.c src/hacks.c src/cia.c src/vic.c src/core.cpp src/digi.cpp src/sidplayer.cpp -s EXPORTED_FUNCTIONS="['_getStereoLevel','_setStereoLevel','_getReverbLevel','_setReverbLevel','_getHeadphoneMode','_setHeadphoneMode','_getCutoff6581', '_getFilterConfig6581', '_setFilterConfig6581', '_loadSidFile', '_playTune', '_getMusicInfo', '_getSampleRate', '_getSoundBuffer', '_getSoundBufferLen', '_computeAudioSamples', '_enableVoices', '_envIsSID6581', '_envSetSID6581', '_envIsNTSC', '_envSetNTSC', '_getBufferVoice1', '_getBufferVoice2', '_getBufferVoice3', '_getBufferVoice4', '_setRegisterSID', '_getRegisterSID', '_getRAM', '_setRAM', '_getDigiType', '_getDigiTypeDesc', '_getDigiRate', '_getNumberTraceStreams', '_getTraceStreams', '_countSIDs', '_getSIDRegister', '_getSIDRegister2', '_setSIDRegister', '_getSIDBaseAddr', '_readVoiceLevel', '_initPanningCfg', '_getPanning', '_setPanning', '_malloc', '_free']" -o htdocs/tinyrsid.js -s SINGLE_FILE=0 -s EXTRA_EXPORTED_RUNTIME_METHODS=['ccall']  -s BINARYEN_ASYNC_COMPILATION=1 -s BINARYEN_TRAP_MODE='clamp' && copy /b shell-pre.js + htdocs\tinyrsid.js + shell-post.js htdocs\tinyrsid3.js && del htdocs\tinyrsid.js && copy /b htdocs\tinyrsid3.js + tinyrsid_adapter.js htdocs\backend_tinyrsid.js && del htdocs\tinyrsid3.js
-::emcc.bat -s TOTAL_MEMORY=33554432 -s WASM=0 -s ASSERTIONS=2 -s SAFE_HEAP=1 -s VERBOSE=0 -DDEBUG -fno-rtti -Wno-pointer-sign -I./src  --memory-init-file 0  -s NO_FILESYSTEM=1 src/loaders.cpp src/filter.cpp src/envelope.cpp src/sid.cpp src/memory.c src/cpu.c src/hacks.c src/cia.c src/vic.c src/core.cpp src/digi.cpp src/sidplayer.cpp -s EXPORTED_FUNCTIONS="['_loadSidFile', '_playTune', '_getMusicInfo', '_getSampleRate', '_getSoundBuffer', '_getSoundBufferLen', '_computeAudioSamples', '_enableVoices', '_envIsSID6581', '_envSetSID6581', '_envIsNTSC', '_envSetNTSC', '_getBufferVoice1', '_getBufferVoice2', '_getBufferVoice3', '_getBufferVoice4', '_getRegisterSID', '_getRAM', '_setRAM', '_getDigiType', '_getDigiTypeDesc', '_getDigiRate', '_malloc', '_free']" -o htdocs/tinyrsid.js -s SINGLE_FILE=0 -s EXTRA_EXPORTED_RUNTIME_METHODS=['ccall']  -s BINARYEN_ASYNC_COMPILATION=1 -s BINARYEN_TRAP_MODE='clamp' && copy /b shell-pre.js + htdocs\tinyrsid.js + shell-post.js htdocs\tinyrsid3.js && del htdocs\tinyrsid.js && copy /b htdocs\tinyrsid3.js + tinyrsid_adapter.js htdocs\backend_tinyrsid.js && del htdocs\tinyrsid3.js
+emcc.bat -s WASM=1 -funroll-loops -Os -O3 -s ASSERTIONS=0 -s SAFE_HEAP=0 -s VERBOSE=0 -fno-rtti -fno-exceptions -Wno-pointer-sign --closure 1 --llvm-lto 1 -I./src  -I./src/stereo  -I./src/stereo/Common  --memory-init-file 0  -s NO_FILESYSTEM=1 built/stereo1.bc  built/stereo2.bc  src/loaders.cpp src/filter.cpp src/filter6581.cpp src/filter8580.cpp src/wavegenerator.cpp src/envelope.cpp src/sid.cpp src/memory.c src/system.cpp src/cpu.c src/hacks.c src/cia.c src/vic.c src/core.cpp src/decimator.cpp src/digi.cpp src/spectrum.cpp src/sidplayer.cpp -s EXPORTED_FUNCTIONS="['_getStereoLevel','_setStereoLevel','_getReverbLevel','_setReverbLevel','_getHeadphoneMode','_setHeadphoneMode','_setSegmentedSynthesis','_setOversampling','_setSkipSilenceBudget', '_setFilterRate', '_render', '_setOutputFormat', '_enableNoteEvents', '_getNoteEvents', '_getNoteEventCount', '_setSpectrum', '_getSpectrum', '_getSpectrumLayout', '_setOutputBuffer', '_getMaxBlockLen', '_getOutputRingSize', '_setOutputRing','_setBandLimitedWaveforms','_getCutoff6581', '_getFilterConfig6581', '_setFilterConfig6581', '_loadSidFile', '_playTune', '_getMusicInfo', '_getSampleRate', '_getSoundBuffer', '_getSoundBufferLen', '_computeAudioSamples', '_enableVoices', '_envIsSID6581', '_envSetSID6581', '_envIsNTSC', '_envSetNTSC', '_getBufferVoice1', '_getBufferVoice2', '_getBufferVoice3', '_getBufferVoice4', '_setRegisterSID', '_getRegisterSID', '_getRAM', '_setRAM', '_getDigiType', '_getDigiTypeDesc', '_getDigiRate', '_getDigiWriteCount', '_getDigiDetectCount', '_getNumberTraceStreams', '_getTraceStreams', '_setTraceRing', '_getTraceRingInfo', '_countSIDs', '_getSIDRegister', '_getSIDRegister2', '_setSIDRegister', '_getSIDBaseAddr', '_readVoiceLevel', '_getSIDRegSnapshots', '_getSIDRegSnapshotsLen', '_getSIDRegSnapshotLayout', '_initPanningCfg', '_getPanning', '_setPanning', '_malloc', '_free']" -o htdocs/tinyrsid.js -s SINGLE_FILE=0 -s EXTRA_EXPORTED_RUNTIME_METHODS=['ccall']  -s BINARYEN_ASYNC_COMPILATION=1 -s BINARYEN_TRAP_MODE='clamp' && copy /b shell-pre.js + htdocs\tinyrsid.js + shell-post.js htdocs\tinyrsid3.js && del htdocs\tinyrsid.js && copy /b htdocs\tinyrsid3.js + tinyrsid_adapter.js htdocs\backend_tinyrsid.js && del htdocs\tinyrsid3.js
+::emcc.bat -s TOTAL_MEMORY=33554432 -s WASM=0 -s ASSERTIONS=2 -s SAFE_HEAP=1 -s VERBOSE=0 -DDEBUG -fno-rtti -Wno-pointer-sign -I./src  --memory-init-file 0  -s NO_FILESYSTEM=1 src/loaders.cpp src/filter.cpp src/envelope.cpp src/sid.cpp src/memory.c src/cpu.c src/hacks.c src/cia.c src/vic.c src/core.cpp src/digi.cpp src/spectrum.cpp src/sidplayer.cpp -s EXPORTED_FUNCTIONS="['_loadSidFile', '_playTune', '_getMusicInfo', '_getSampleRate', '_getSoundBuffer', '_getSoundBufferLen', '_computeAudioSamples', '_enableVoices', '_envIsSID6581', '_envSetSID6581', '_envIsNTSC', '_envSetNTSC', '_getBufferVoice1', '_getBufferVoice2', '_getBufferVoice3', '_getBufferVoice4', '_getRegisterSID', '_getRAM', '_setRAM', '_getDigiType', '_getDigiTypeDesc', '_getDigiRate', '_malloc', '_free']" -o htdocs/tinyrsid.js -s SINGLE_FILE=0 -s EXTRA_EXPORTED_RUNTIME_METHODS=['ccall']  -s BINARYEN_ASYNC_COMPILATION=1 -s BINARYEN_TRAP_MODE='clamp' && copy /b shell-pre.js + htdocs\tinyrsid.js + shell-post.js htdocs\tinyrsid3.js && del htdocs\tinyrsid.js && copy /b htdocs\tinyrsid3.js + tinyrsid_adapter.js htdocs\backend_tinyrsid.js && del htdocs\tinyrsid3.js
 
 
 :END
\ No newline at end of file
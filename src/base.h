@@ -49,5 +49,10 @@ typedef enum {
 
 #define MAX_SIDS 10			// might eventually need to be increased 
 
+#define MAX_OVERSAMPLING 8	// max number of sub-samples rendered per output sample
+#define MAX_INTERNAL_SAMPLE_RATE (MAX_OVERSAMPLING * 48000)	// oversampling is limited accordingly
+
+#define CACHELINE_SIZE 64	// used to align the hot emulator state
+
 
 #endif
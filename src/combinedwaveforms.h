@@ -0,0 +1,1423 @@
+/*
+* Precalculated "combined waveform" lookup tables (see WaveGenerator::combinedWF()).
+*
+* These are Hermit's tables ("I found out how the combined waveform works (neighboring
+* bits affect each other recursively)") which used to be calculated at startup. Each
+* entry i (12-bit accumulator index) was derived as follows (neighbour-bit strength and
+* DAC MOSFET threshold are approximately set by ears'n'trials):
+*
+*	for (j = 0; j < 12; j++) {
+*		bitlevel = 0;
+*		for (k = 0; k < 12; k++) {
+*			bitlevel += (bitmul / pow(bitstrength, abs(k - j))) * (((i >> k) & 1) - 0.5);
+*		}
+*		wfarray[i] += (bitlevel >= threshold) ? pow(2.0, j) : 0;
+*	}
+*	wfarray[i] *= 12;
+*
+* i.e. all values are integers that fit into 16-bits.
+*
+* WebSid (c) 2019 Jürgen Wothke
+* version 0.93
+*
+* Terms of Use: This software is licensed under a CC BY-NC-SA
+* (http://creativecommons.org/licenses/by-nc-sa/4.0/).
+*/
+#ifndef WEBSID_COMBINEDWAVEFORMS_H
+#define WEBSID_COMBINEDWAVEFORMS_H
+
+extern "C" {
+#include "base.h"
+}
+
+// bitmul=0.8, bitstrength=2.4, threshold=0.64
+const uint16_t TriSaw_8580[4096] =
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0120, 0x0120, 0x0150, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x00C0, 0x0240, 0x0240, 0x0240, 0x02A0, 0x02A0, 0x02D0, 0x02F4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x00C0, 0x0120, 0x0120, 0x0150, 0x0174,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0060, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0498, 0x0540, 0x0540, 0x0540, 0x0540,
+0x05A0, 0x05A0, 0x05D0, 0x05F4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0120, 0x0120, 0x0150, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0060, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0180, 0x0198, 0x0240, 0x0240, 0x0240, 0x0240, 0x02A0, 0x02A0, 0x02D0, 0x02F4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x00C0, 0x00C0,
+0x0120, 0x0120, 0x0150, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0060, 0x0090, 0x00B4,
+0x0600, 0x0900, 0x0900, 0x0900, 0x0900, 0x0900, 0x0900, 0x0918, 0x0900, 0x0900, 0x0900, 0x0900,
+0x0900, 0x0900, 0x0930, 0x0954, 0x0A80, 0x0A80, 0x0A80, 0x0A80, 0x0A80, 0x0A80, 0x0A80, 0x0A98,
+0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0BA0, 0x0BA0, 0x0BD0, 0x0BF4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0120, 0x0120, 0x0150, 0x0174,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0240, 0x0240, 0x0240, 0x0240,
+0x02A0, 0x02A0, 0x02D0, 0x02F4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x00C0, 0x0120, 0x0120, 0x0150, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0060, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0300, 0x0300, 0x0300, 0x0354, 0x0480, 0x0480, 0x0480, 0x0480,
+0x0480, 0x0480, 0x0480, 0x0498, 0x0540, 0x0540, 0x0540, 0x0540, 0x05A0, 0x05A0, 0x05D0, 0x05F4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0120, 0x0120, 0x0150, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0060, 0x0090, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000, 0x0180, 0x0180, 0x0180, 0x0198,
+0x0240, 0x0240, 0x0240, 0x0240, 0x02A0, 0x02A0, 0x02D0, 0x02F4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x00C0, 0x00C0, 0x0120, 0x0120, 0x0150, 0x0174,
+0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200,
+0x1200, 0x1200, 0x1200, 0x1254, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1218,
+0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1260, 0x1290, 0x12B4, 0x1500, 0x1500, 0x1500, 0x1500,
+0x1500, 0x1500, 0x1500, 0x1518, 0x1500, 0x1500, 0x1500, 0x1500, 0x1500, 0x1500, 0x1530, 0x1554,
+0x1680, 0x1680, 0x1680, 0x1680, 0x1680, 0x1680, 0x1680, 0x1698, 0x1740, 0x1740, 0x1740, 0x1740,
+0x17A0, 0x17A0, 0x17D0, 0x17F4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0120, 0x0120, 0x0150, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0240, 0x0240, 0x0240, 0x0240, 0x02A0, 0x02A0, 0x02D0, 0x02F4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x00C0,
+0x0120, 0x0120, 0x0150, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0060, 0x0090, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0498,
+0x0540, 0x0540, 0x0540, 0x0540, 0x05A0, 0x05A0, 0x05D0, 0x05F4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0120, 0x0120, 0x0150, 0x0174,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0060, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0180, 0x0198, 0x0240, 0x0240, 0x0240, 0x0240,
+0x02A0, 0x02A0, 0x02D0, 0x02F4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x00C0, 0x00C0, 0x0120, 0x0120, 0x0150, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0600, 0x0600, 0x0600, 0x0600,
+0x0600, 0x0660, 0x0690, 0x06B4, 0x0900, 0x0900, 0x0900, 0x0900, 0x0900, 0x0900, 0x0900, 0x0918,
+0x0900, 0x0900, 0x0900, 0x0900, 0x0900, 0x0900, 0x0930, 0x0954, 0x0A80, 0x0A80, 0x0A80, 0x0A80,
+0x0A80, 0x0A80, 0x0A80, 0x0A98, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0BA0, 0x0BA0, 0x0BD0, 0x0BF4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0120, 0x0120, 0x0150, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0240, 0x0240, 0x0240, 0x0240, 0x02A0, 0x02A0, 0x02D0, 0x02F4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x00C0, 0x0120, 0x0120, 0x0150, 0x0174,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0060, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0354,
+0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0498, 0x0540, 0x0540, 0x0540, 0x0540,
+0x05A0, 0x05A0, 0x05D0, 0x05F4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0120, 0x0120, 0x0150, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0060, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0180, 0x0180, 0x0180, 0x0198, 0x1A40, 0x1A40, 0x1A40, 0x1A40, 0x1AA0, 0x1AA0, 0x1AD0, 0x1AF4,
+0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+0x2400, 0x2400, 0x2400, 0x2454, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2418,
+0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2490, 0x24B4, 0x2400, 0x2400, 0x2400, 0x2400,
+0x2400, 0x2400, 0x2400, 0x2418, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2454,
+0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2418, 0x2400, 0x2400, 0x24C0, 0x24C0,
+0x2520, 0x2520, 0x2550, 0x2574, 0x2A00, 0x2A00, 0x2A00, 0x2A00, 0x2A00, 0x2A00, 0x2A00, 0x2A00,
+0x2A00, 0x2A00, 0x2A00, 0x2A00, 0x2A00, 0x2A00, 0x2A00, 0x2A54, 0x2A00, 0x2A00, 0x2A00, 0x2A00,
+0x2A00, 0x2A00, 0x2A00, 0x2A18, 0x2A00, 0x2A00, 0x2A00, 0x2A00, 0x2A00, 0x2A60, 0x2A90, 0x2AB4,
+0x2D00, 0x2D00, 0x2D00, 0x2D00, 0x2D00, 0x2D00, 0x2D00, 0x2D18, 0x2D00, 0x2D00, 0x2D00, 0x2D00,
+0x2D00, 0x2D00, 0x2D30, 0x2D54, 0x2E80, 0x2E80, 0x2E80, 0x2E80, 0x2E80, 0x2E80, 0x2E80, 0x2E98,
+0x2F40, 0x2F40, 0x2F40, 0x2F40, 0x2FA0, 0x2FA0, 0x2FD0, 0x2FF4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0120, 0x0120, 0x0150, 0x0174,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0240, 0x0240, 0x0240, 0x0240,
+0x02A0, 0x02A0, 0x02D0, 0x02F4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x00C0, 0x0120, 0x0120, 0x0150, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0060, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0480, 0x0480, 0x0480, 0x0480,
+0x0480, 0x0480, 0x0480, 0x0498, 0x0540, 0x0540, 0x0540, 0x0540, 0x05A0, 0x05A0, 0x05D0, 0x05F4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0120, 0x0120, 0x0150, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0060, 0x0090, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0180, 0x0198,
+0x0240, 0x0240, 0x0240, 0x0240, 0x02A0, 0x02A0, 0x02D0, 0x02F4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x00C0, 0x00C0, 0x0120, 0x0120, 0x0150, 0x0174,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0060, 0x0090, 0x00B4, 0x0900, 0x0900, 0x0900, 0x0900,
+0x0900, 0x0900, 0x0900, 0x0918, 0x0900, 0x0900, 0x0900, 0x0900, 0x0900, 0x0900, 0x0930, 0x0954,
+0x0A80, 0x0A80, 0x0A80, 0x0A80, 0x0A80, 0x0A80, 0x0A80, 0x0A98, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+0x0BA0, 0x0BA0, 0x0BD0, 0x0BF4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0120, 0x0120, 0x0150, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0240, 0x0240, 0x0240, 0x0240, 0x02A0, 0x02A0, 0x02D0, 0x02F4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x00C0,
+0x0120, 0x0120, 0x0150, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0060, 0x0090, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0300,
+0x0300, 0x0300, 0x0300, 0x0354, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0498,
+0x0540, 0x0540, 0x0540, 0x0540, 0x05A0, 0x05A0, 0x05D0, 0x05F4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0120, 0x0120, 0x0150, 0x0174,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0060, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0180, 0x0180, 0x0180, 0x0198, 0x0240, 0x0240, 0x0240, 0x0240,
+0x02A0, 0x02A0, 0x02D0, 0x02F4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0C00, 0x0C00, 0x0C00, 0x0C00,
+0x0C00, 0x0C00, 0x0C00, 0x0C54, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C18,
+0x0C00, 0x0C00, 0x0CC0, 0x0CC0, 0x0D20, 0x0D20, 0x0D50, 0x0D74, 0x1200, 0x1200, 0x1200, 0x1200,
+0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1254,
+0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1218, 0x1200, 0x1200, 0x1200, 0x1200,
+0x1200, 0x1260, 0x1290, 0x12B4, 0x1500, 0x1500, 0x1500, 0x1500, 0x1500, 0x1500, 0x1500, 0x1518,
+0x1500, 0x1500, 0x1500, 0x1500, 0x1500, 0x1500, 0x1530, 0x1554, 0x1680, 0x1680, 0x1680, 0x1680,
+0x1680, 0x1680, 0x1680, 0x1698, 0x1740, 0x1740, 0x1740, 0x1740, 0x17A0, 0x17A0, 0x17D0, 0x17F4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0120, 0x0120, 0x0150, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0240, 0x0240, 0x0240, 0x0240, 0x02A0, 0x02A0, 0x02D0, 0x02F4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x00C0, 0x0120, 0x0120, 0x0150, 0x0174,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0060, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0498, 0x0540, 0x0540, 0x0540, 0x0540,
+0x05A0, 0x05A0, 0x05D0, 0x05F4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0120, 0x0120, 0x0150, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0060, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0180, 0x0180, 0x0198, 0x0240, 0x0240, 0x0240, 0x0240, 0x02A0, 0x02A0, 0x02D0, 0x02F4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x00C0, 0x00C0,
+0x0120, 0x0120, 0x0150, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0600, 0x0600, 0x0600, 0x0600,
+0x0600, 0x0600, 0x0600, 0x0618, 0x0600, 0x0600, 0x0600, 0x0600, 0x0600, 0x0660, 0x0690, 0x06B4,
+0x0900, 0x0900, 0x0900, 0x0900, 0x0900, 0x0900, 0x0900, 0x0918, 0x0900, 0x0900, 0x0900, 0x0900,
+0x0900, 0x0900, 0x0930, 0x0954, 0x0A80, 0x0A80, 0x0A80, 0x0A80, 0x0A80, 0x0A80, 0x0A80, 0x0A98,
+0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0BA0, 0x0BA0, 0x0BD0, 0x0BF4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0120, 0x0120, 0x0150, 0x0174,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3000, 0x3000, 0x3000, 0x3000,
+0x3000, 0x3000, 0x3000, 0x3054, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3018,
+0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3090, 0x30B4, 0x3000, 0x3000, 0x3000, 0x3000,
+0x3000, 0x3000, 0x3000, 0x3018, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3054,
+0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3018, 0x3240, 0x3240, 0x3240, 0x3240,
+0x32A0, 0x32A0, 0x32D0, 0x32F4, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3054, 0x3000, 0x3000, 0x3000, 0x3000,
+0x3000, 0x3000, 0x3000, 0x3018, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3090, 0x30B4,
+0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3018, 0x3000, 0x3000, 0x3000, 0x3000,
+0x3000, 0x3000, 0x3000, 0x3054, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3018,
+0x3000, 0x3000, 0x3000, 0x30C0, 0x3120, 0x3120, 0x3150, 0x3174, 0x3000, 0x3000, 0x3000, 0x3000,
+0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3054,
+0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3018, 0x3000, 0x3000, 0x3000, 0x3000,
+0x3000, 0x3060, 0x3090, 0x30B4, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3018,
+0x3300, 0x3300, 0x3300, 0x3300, 0x3300, 0x3300, 0x3300, 0x3354, 0x3480, 0x3480, 0x3480, 0x3480,
+0x3480, 0x3480, 0x3480, 0x3498, 0x3540, 0x3540, 0x3540, 0x3540, 0x35A0, 0x35A0, 0x35D0, 0x35F4,
+0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA800,
+0xA800, 0xA800, 0xA800, 0xA854, 0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA818,
+0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA890, 0xA8B4, 0xA800, 0xA800, 0xA800, 0xA800,
+0xA800, 0xA800, 0xA800, 0xA818, 0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA854,
+0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA818, 0xA800, 0xA800, 0xA800, 0xA800,
+0xA920, 0xA920, 0xA950, 0xA974, 0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA800,
+0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA854, 0xA800, 0xA800, 0xA800, 0xA800,
+0xA800, 0xA800, 0xA800, 0xA818, 0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA860, 0xA890, 0xA8B4,
+0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA818, 0xA800, 0xA800, 0xA800, 0xA800,
+0xA800, 0xA800, 0xA800, 0xA854, 0xA800, 0xA800, 0xA800, 0xA800, 0xA980, 0xA980, 0xA980, 0xA998,
+0xAA40, 0xAA40, 0xAA40, 0xAA40, 0xAAA0, 0xAAA0, 0xAAD0, 0xAAF4, 0xB400, 0xB400, 0xB400, 0xB400,
+0xB400, 0xB400, 0xB400, 0xB400, 0xB400, 0xB400, 0xB400, 0xB400, 0xB400, 0xB400, 0xB400, 0xB454,
+0xB400, 0xB400, 0xB400, 0xB400, 0xB400, 0xB400, 0xB400, 0xB418, 0xB400, 0xB400, 0xB400, 0xB400,
+0xB400, 0xB400, 0xB490, 0xB4B4, 0xB400, 0xB400, 0xB400, 0xB400, 0xB400, 0xB400, 0xB400, 0xB418,
+0xB400, 0xB400, 0xB400, 0xB400, 0xB400, 0xB400, 0xB400, 0xB454, 0xB400, 0xB400, 0xB400, 0xB400,
+0xB400, 0xB400, 0xB400, 0xB418, 0xB400, 0xB400, 0xB4C0, 0xB4C0, 0xB520, 0xB520, 0xB550, 0xB574,
+0xBA00, 0xBA00, 0xBA00, 0xBA00, 0xBA00, 0xBA00, 0xBA00, 0xBA00, 0xBA00, 0xBA00, 0xBA00, 0xBA00,
+0xBA00, 0xBA00, 0xBA00, 0xBA54, 0xBA00, 0xBA00, 0xBA00, 0xBA00, 0xBA00, 0xBA00, 0xBA00, 0xBA18,
+0xBA00, 0xBA00, 0xBA00, 0xBA00, 0xBA00, 0xBA60, 0xBA90, 0xBAB4, 0xBD00, 0xBD00, 0xBD00, 0xBD00,
+0xBD00, 0xBD00, 0xBD00, 0xBD18, 0xBD00, 0xBD00, 0xBD00, 0xBD00, 0xBD00, 0xBD00, 0xBD30, 0xBD54,
+0xBE80, 0xBE80, 0xBE80, 0xBE80, 0xBE80, 0xBE80, 0xBE80, 0xBE98, 0xBF40, 0xBF40, 0xBF40, 0xBF40,
+0xBFA0, 0xBFA0, 0xBFD0, 0xBFF4
+};
+
+// bitmul=1.4, bitstrength=1.9, threshold=0.68
+const uint16_t PulseSaw_8580[4096] =
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x0030, 0x0054, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0060, 0x0090, 0x00A8, 0x00B4, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0030, 0x00A8, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0030, 0x0054, 0x00C0, 0x00C0, 0x0120, 0x0144,
+0x0150, 0x0150, 0x0168, 0x02F4, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0048, 0x00B4, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0084, 0x0120, 0x0150, 0x0168, 0x0174,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0090, 0x00A8, 0x0234, 0x0000, 0x0180, 0x0180, 0x018C, 0x0240, 0x0240, 0x0270, 0x0294,
+0x0240, 0x02A0, 0x02A0, 0x02C4, 0x02D0, 0x02DC, 0x05E8, 0x05F4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0048, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0084,
+0x0060, 0x0090, 0x0168, 0x0174, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0090, 0x00A8, 0x00B4, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x00F0, 0x0294, 0x0240, 0x02A0, 0x02A0, 0x02C4, 0x02D0, 0x02DC, 0x02E8, 0x02F4,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0000, 0x00A8, 0x00B4, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0120, 0x0144, 0x0120, 0x0150, 0x0468, 0x0474, 0x0000, 0x0300, 0x0300, 0x030C,
+0x0300, 0x0300, 0x0300, 0x04D4, 0x0480, 0x0480, 0x0480, 0x04A4, 0x04E0, 0x0510, 0x0528, 0x0534,
+0x0480, 0x0480, 0x0540, 0x0564, 0x0540, 0x0540, 0x0588, 0x0594, 0x05A0, 0x05A0, 0x05A0, 0x0BC4,
+0x0BD0, 0x0BDC, 0x0BE8, 0x0BF4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0048, 0x0054, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0024, 0x0060, 0x0090, 0x00A8, 0x0174,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0030, 0x00A8, 0x00B4, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0030, 0x0114,
+0x00C0, 0x00C0, 0x0120, 0x02C4, 0x02D0, 0x02DC, 0x02E8, 0x02F4, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0048, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0144,
+0x0120, 0x0150, 0x0168, 0x0174, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x01A4, 0x0180, 0x0210, 0x0528, 0x0534, 0x0480, 0x0480, 0x0480, 0x054C,
+0x0540, 0x0540, 0x0570, 0x0594, 0x0540, 0x05A0, 0x05A0, 0x05C4, 0x05D0, 0x05DC, 0x05E8, 0x05F4,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0000, 0x0048, 0x00B4, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0084, 0x0060, 0x0150, 0x0168, 0x0174, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0090, 0x00A8, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x018C, 0x0180, 0x0240, 0x0270, 0x0294, 0x0240, 0x02A0, 0x02A0, 0x08C4,
+0x08D0, 0x08DC, 0x08E8, 0x08F4, 0x0600, 0x0600, 0x0600, 0x060C, 0x0600, 0x0600, 0x0600, 0x0654,
+0x0600, 0x0600, 0x0600, 0x0624, 0x0600, 0x0630, 0x09A8, 0x09B4, 0x0900, 0x0900, 0x0900, 0x090C,
+0x0900, 0x0900, 0x0930, 0x0954, 0x0900, 0x09C0, 0x0A20, 0x0A44, 0x0A50, 0x0A50, 0x0A68, 0x0A74,
+0x0900, 0x0900, 0x0900, 0x0A8C, 0x0A80, 0x0A80, 0x0A80, 0x0AD4, 0x0A80, 0x0A80, 0x0A80, 0x0AA4,
+0x0AE0, 0x1710, 0x1728, 0x17F4, 0x1680, 0x1740, 0x1740, 0x1764, 0x1740, 0x1740, 0x1788, 0x17F4,
+0x17A0, 0x17A0, 0x17A0, 0x17C4, 0x17D0, 0x17DC, 0x17E8, 0x17F4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0048, 0x0054,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0060, 0x0090, 0x00A8, 0x0174, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0030, 0x00A8, 0x00B4, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x0030, 0x0114, 0x00C0, 0x00C0, 0x0120, 0x0144, 0x0150, 0x02DC, 0x02E8, 0x02F4,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0000, 0x0048, 0x00B4, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0144, 0x0120, 0x0150, 0x0168, 0x0174, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0210, 0x0228, 0x0234,
+0x0180, 0x0180, 0x0180, 0x024C, 0x0240, 0x0240, 0x0570, 0x0594, 0x0540, 0x05A0, 0x05A0, 0x05C4,
+0x05D0, 0x05DC, 0x05E8, 0x05F4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0048, 0x00B4, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0084, 0x0060, 0x0150, 0x0168, 0x0174,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0090, 0x00A8, 0x00B4, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0240, 0x0270, 0x0294,
+0x0240, 0x02A0, 0x02A0, 0x02C4, 0x02D0, 0x02DC, 0x02E8, 0x02F4, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x00A8, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0300, 0x0354, 0x0300, 0x03C0, 0x0420, 0x0A44,
+0x0A20, 0x0A50, 0x0A68, 0x0A74, 0x0900, 0x0900, 0x0900, 0x090C, 0x0900, 0x0A80, 0x0A80, 0x0AD4,
+0x0A80, 0x0A80, 0x0A80, 0x0AA4, 0x0AE0, 0x0B10, 0x0B28, 0x0B34, 0x0A80, 0x0B40, 0x0B40, 0x0B64,
+0x0B40, 0x0B40, 0x0B88, 0x0B94, 0x0BA0, 0x0BA0, 0x0BA0, 0x0BC4, 0x0BD0, 0x0BDC, 0x0BE8, 0x0BF4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0000, 0x0048, 0x0054, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0060, 0x0090, 0x0168, 0x0174, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0030, 0x00A8, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x00F0, 0x0114, 0x00C0, 0x0240, 0x02A0, 0x02C4,
+0x02D0, 0x02DC, 0x02E8, 0x02F4, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0048, 0x00B4, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x00C0, 0x0144, 0x0120, 0x0150, 0x0168, 0x0174,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0300, 0x0354, 0x0300, 0x0480, 0x0480, 0x04A4,
+0x0480, 0x1110, 0x1128, 0x1134, 0x1080, 0x1080, 0x1140, 0x1164, 0x1140, 0x1140, 0x1188, 0x1194,
+0x1140, 0x11A0, 0x11A0, 0x11C4, 0x11D0, 0x11DC, 0x11E8, 0x11F4, 0x0C00, 0x0C00, 0x0C00, 0x0C0C,
+0x0C00, 0x0C00, 0x0C00, 0x0C24, 0x0C00, 0x0C00, 0x0C00, 0x0C24, 0x0C00, 0x0C00, 0x0C48, 0x0CB4,
+0x0C00, 0x0C00, 0x0C00, 0x0C0C, 0x0C00, 0x0C00, 0x0C00, 0x0C54, 0x0C00, 0x0C00, 0x0C00, 0x1284,
+0x1320, 0x1350, 0x1368, 0x1374, 0x1200, 0x1200, 0x1200, 0x120C, 0x1200, 0x1200, 0x1200, 0x1254,
+0x1200, 0x1200, 0x1200, 0x1224, 0x1200, 0x1290, 0x12A8, 0x12B4, 0x1200, 0x1380, 0x1380, 0x138C,
+0x1440, 0x1440, 0x1470, 0x1494, 0x2C40, 0x2CA0, 0x2CA0, 0x2CC4, 0x2CD0, 0x2CDC, 0x2CE8, 0x2CF4,
+0x2A00, 0x2A00, 0x2A00, 0x2A0C, 0x2A00, 0x2A00, 0x2D00, 0x2D54, 0x2D00, 0x2D00, 0x2D00, 0x2D24,
+0x2D00, 0x2D30, 0x2DA8, 0x2DB4, 0x2D00, 0x2D00, 0x2D00, 0x2D0C, 0x2D00, 0x2D00, 0x2D30, 0x2D54,
+0x2DC0, 0x2DC0, 0x2E20, 0x2E44, 0x2E50, 0x2E5C, 0x2E68, 0x2FF4, 0x2D00, 0x2E80, 0x2E80, 0x2E8C,
+0x2E80, 0x2E80, 0x2E80, 0x2ED4, 0x2E80, 0x2E80, 0x2E80, 0x2EA4, 0x2EE0, 0x2F10, 0x2F28, 0x2FF4,
+0x2F40, 0x2F40, 0x2F40, 0x2F64, 0x2F40, 0x2F40, 0x2F88, 0x2FF4, 0x2FA0, 0x2FA0, 0x2FA0, 0x2FC4,
+0x2FD0, 0x2FDC, 0x2FE8, 0x2FF4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0048, 0x0054, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0024, 0x0060, 0x0090, 0x00A8, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0030, 0x00A8, 0x00B4, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0030, 0x0054,
+0x00C0, 0x00C0, 0x0120, 0x0144, 0x0150, 0x015C, 0x02E8, 0x02F4, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0048, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0084,
+0x0120, 0x0150, 0x0168, 0x0174, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0090, 0x0228, 0x0234, 0x0180, 0x0180, 0x0180, 0x018C,
+0x0240, 0x0240, 0x0270, 0x0294, 0x0240, 0x02A0, 0x05A0, 0x05C4, 0x05D0, 0x05DC, 0x05E8, 0x05F4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0000, 0x0048, 0x00B4, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0084, 0x0060, 0x0090, 0x0168, 0x0174, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0090, 0x00A8, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0270, 0x0294, 0x0240, 0x02A0, 0x02A0, 0x02C4,
+0x02D0, 0x02DC, 0x02E8, 0x02F4, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x00A8, 0x00B4, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0420, 0x0444, 0x0420, 0x0450, 0x0468, 0x0474,
+0x0300, 0x0300, 0x0300, 0x030C, 0x0300, 0x0300, 0x0480, 0x04D4, 0x0480, 0x0480, 0x0480, 0x0AA4,
+0x0AE0, 0x0B10, 0x0B28, 0x0B34, 0x0A80, 0x0A80, 0x0B40, 0x0B64, 0x0B40, 0x0B40, 0x0B88, 0x0B94,
+0x0BA0, 0x0BA0, 0x0BA0, 0x0BC4, 0x0BD0, 0x0BDC, 0x0BE8, 0x0BF4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0048, 0x0054,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0060, 0x0090, 0x00A8, 0x0174, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0030, 0x00A8, 0x00B4, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x0030, 0x0114, 0x00C0, 0x00C0, 0x02A0, 0x02C4, 0x02D0, 0x02DC, 0x02E8, 0x02F4,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0000, 0x0048, 0x00B4, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0144, 0x0120, 0x0150, 0x0168, 0x0174, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0480, 0x04A4, 0x0480, 0x0510, 0x0528, 0x0534,
+0x0480, 0x0480, 0x0480, 0x054C, 0x0540, 0x0540, 0x0570, 0x0594, 0x0540, 0x05A0, 0x05A0, 0x05C4,
+0x05D0, 0x05DC, 0x05E8, 0x05F4, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0048, 0x00B4, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0084, 0x0060, 0x0150, 0x0168, 0x0174,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0624,
+0x0600, 0x1290, 0x12A8, 0x12B4, 0x1200, 0x1200, 0x1380, 0x138C, 0x1380, 0x1440, 0x1470, 0x1494,
+0x1440, 0x14A0, 0x14A0, 0x14C4, 0x14D0, 0x14DC, 0x14E8, 0x14F4, 0x1200, 0x1200, 0x1200, 0x120C,
+0x1200, 0x1200, 0x1200, 0x1254, 0x1200, 0x1200, 0x1500, 0x1524, 0x1500, 0x1530, 0x15A8, 0x15B4,
+0x1500, 0x1500, 0x1500, 0x150C, 0x1500, 0x1500, 0x1530, 0x1554, 0x1500, 0x15C0, 0x1620, 0x1644,
+0x1650, 0x1650, 0x1668, 0x1674, 0x1500, 0x1500, 0x1680, 0x168C, 0x1680, 0x1680, 0x1680, 0x16D4,
+0x1680, 0x1680, 0x1680, 0x16A4, 0x16E0, 0x1710, 0x1728, 0x17F4, 0x1680, 0x1740, 0x1740, 0x1764,
+0x1740, 0x1740, 0x1788, 0x17F4, 0x17A0, 0x17A0, 0x17A0, 0x17C4, 0x17D0, 0x17DC, 0x17E8, 0x17F4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0000, 0x0048, 0x0054, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0060, 0x0090, 0x00A8, 0x0174, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0030, 0x00A8, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0030, 0x0114, 0x00C0, 0x00C0, 0x0120, 0x0144,
+0x02D0, 0x02DC, 0x02E8, 0x02F4, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0048, 0x00B4, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0144, 0x0120, 0x0150, 0x0168, 0x0174,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0180, 0x0210, 0x0228, 0x0234, 0x0180, 0x0180, 0x0480, 0x054C, 0x0540, 0x0540, 0x0570, 0x0594,
+0x0540, 0x05A0, 0x05A0, 0x05C4, 0x05D0, 0x05DC, 0x05E8, 0x05F4, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0048, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0084,
+0x0060, 0x0150, 0x0168, 0x0174, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0090, 0x00A8, 0x00B4, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0180, 0x0240, 0x0270, 0x0294, 0x1A40, 0x1AA0, 0x1AA0, 0x1AC4, 0x1AD0, 0x1ADC, 0x1AE8, 0x1AF4,
+0x1800, 0x1800, 0x1800, 0x180C, 0x1800, 0x1800, 0x1800, 0x1824, 0x1800, 0x1800, 0x1800, 0x1E24,
+0x1E00, 0x1E00, 0x1EA8, 0x1EB4, 0x1E00, 0x1E00, 0x2100, 0x210C, 0x2100, 0x2100, 0x2100, 0x2154,
+0x2100, 0x21C0, 0x2220, 0x2244, 0x2220, 0x2250, 0x2268, 0x2274, 0x2100, 0x2100, 0x2100, 0x210C,
+0x2280, 0x2280, 0x2280, 0x22D4, 0x2280, 0x2280, 0x2280, 0x52A4, 0x52E0, 0x5310, 0x5328, 0x5334,
+0x5280, 0x5340, 0x5340, 0x5364, 0x5340, 0x5340, 0x5388, 0x5394, 0x53A0, 0x53A0, 0x53A0, 0x53C4,
+0x53D0, 0x53DC, 0x53E8, 0x53F4, 0x1800, 0x4800, 0x4800, 0x4800, 0x4800, 0x4800, 0x4800, 0x4824,
+0x4800, 0x4800, 0x4800, 0x4824, 0x4800, 0x4800, 0x4848, 0x48B4, 0x4800, 0x4800, 0x4800, 0x480C,
+0x4800, 0x4800, 0x4800, 0x4854, 0x4800, 0x4800, 0x4800, 0x4884, 0x4860, 0x4890, 0x4968, 0x4974,
+0x4800, 0x4800, 0x4800, 0x480C, 0x4800, 0x4800, 0x4800, 0x4854, 0x4800, 0x4800, 0x4800, 0x4824,
+0x4800, 0x5490, 0x54A8, 0x54B4, 0x5400, 0x5400, 0x5400, 0x540C, 0x5400, 0x5400, 0x54F0, 0x5514,
+0x5640, 0x56A0, 0x56A0, 0x56C4, 0x56D0, 0x56DC, 0x56E8, 0x56F4, 0x5400, 0x5400, 0x5400, 0x540C,
+0x5400, 0x5400, 0x5400, 0x5424, 0x5400, 0x5400, 0x5400, 0x5424, 0x5400, 0x5400, 0x54A8, 0x54B4,
+0x5400, 0x5400, 0x5400, 0x540C, 0x5400, 0x5400, 0x5400, 0x5454, 0x5400, 0x5400, 0x5520, 0x5544,
+0x5520, 0x5550, 0x5568, 0x5574, 0x5400, 0x5400, 0x5700, 0x570C, 0x5700, 0x5700, 0x5700, 0x5754,
+0x5880, 0x5880, 0x5880, 0x58A4, 0x58E0, 0x5910, 0x5928, 0x5934, 0x5880, 0x5880, 0x5940, 0x5964,
+0x5940, 0x5940, 0x5988, 0x5994, 0x59A0, 0x59A0, 0x59A0, 0x59C4, 0x59D0, 0x59DC, 0x59E8, 0x59F4,
+0x5400, 0x5400, 0x5400, 0x540C, 0x5400, 0x5400, 0x5400, 0x5424, 0x5400, 0x5400, 0x5400, 0x5A24,
+0x5A00, 0x5A00, 0x5A48, 0x5AB4, 0x5A00, 0x5A00, 0x5A00, 0x5A0C, 0x5A00, 0x5A00, 0x5A00, 0x5A54,
+0x5A00, 0x5A00, 0x5A00, 0x5A84, 0x5B20, 0x5B50, 0x5B68, 0x5B74, 0x5A00, 0x5A00, 0x5A00, 0x5A0C,
+0x5A00, 0x5A00, 0x5A00, 0x5A54, 0x5A00, 0x5A00, 0x5A00, 0x5A24, 0x5A00, 0x5A90, 0x5AA8, 0x5C34,
+0x5B80, 0x5B80, 0x5B80, 0x5B8C, 0x5C40, 0x5C40, 0x5C70, 0x5C94, 0x5C40, 0x5CA0, 0x5CA0, 0x5CC4,
+0x5CD0, 0x5FDC, 0x5FE8, 0x5FF4, 0x5A00, 0x5A00, 0x5D00, 0x5D0C, 0x5D00, 0x5D00, 0x5D00, 0x5D54,
+0x5D00, 0x5D00, 0x5D00, 0x5D24, 0x5D00, 0x5D30, 0x5DA8, 0x5DB4, 0x5D00, 0x5D00, 0x5D00, 0x5D0C,
+0x5D00, 0x5D00, 0x5D30, 0x5E14, 0x5DC0, 0x5DC0, 0x5E20, 0x5E44, 0x5E50, 0x5E5C, 0x5FE8, 0x5FF4,
+0x5E80, 0x5E80, 0x5E80, 0x5E8C, 0x5E80, 0x5E80, 0x5E80, 0x5ED4, 0x5E80, 0x5E80, 0x5E80, 0x5EA4,
+0x5EE0, 0x5F10, 0x5F28, 0x5FF4, 0x5F40, 0x5F40, 0x5F40, 0x5F64, 0x5F40, 0x5F40, 0x5F88, 0x5FF4,
+0x5FA0, 0x5FA0, 0x5FA0, 0x5FC4, 0x5FD0, 0x5FDC, 0x5FE8, 0x5FF4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0048, 0x0054,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0060, 0x0090, 0x00A8, 0x00B4, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0030, 0x00A8, 0x00B4, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x0030, 0x0054, 0x00C0, 0x00C0, 0x0120, 0x0144, 0x0150, 0x0150, 0x0168, 0x02F4,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0000, 0x0048, 0x00B4, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0084, 0x0120, 0x0150, 0x0168, 0x0174, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0090, 0x00A8, 0x0234,
+0x0180, 0x0180, 0x0180, 0x018C, 0x0240, 0x0240, 0x0270, 0x0294, 0x0240, 0x02A0, 0x02A0, 0x02C4,
+0x05D0, 0x05DC, 0x05E8, 0x05F4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0048, 0x00B4, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0084, 0x0060, 0x0090, 0x0168, 0x0174,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0090, 0x00A8, 0x00B4, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x00F0, 0x0294,
+0x0240, 0x02A0, 0x02A0, 0x02C4, 0x02D0, 0x02DC, 0x02E8, 0x02F4, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x00A8, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0120, 0x0144,
+0x0420, 0x0450, 0x0468, 0x0474, 0x0300, 0x0300, 0x0300, 0x030C, 0x0300, 0x0300, 0x0300, 0x04D4,
+0x0480, 0x0480, 0x0480, 0x04A4, 0x04E0, 0x0510, 0x0528, 0x0534, 0x0480, 0x0480, 0x0540, 0x0B64,
+0x0B40, 0x0B40, 0x0B88, 0x0B94, 0x0BA0, 0x0BA0, 0x0BA0, 0x0BC4, 0x0BD0, 0x0BDC, 0x0BE8, 0x0BF4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0000, 0x0048, 0x0054, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0060, 0x0090, 0x00A8, 0x0174, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0030, 0x00A8, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0030, 0x0114, 0x00C0, 0x00C0, 0x0120, 0x02C4,
+0x02D0, 0x02DC, 0x02E8, 0x02F4, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0048, 0x00B4, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0144, 0x0120, 0x0150, 0x0168, 0x0174,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x01A4,
+0x0480, 0x0510, 0x0528, 0x0534, 0x0480, 0x0480, 0x0480, 0x054C, 0x0540, 0x0540, 0x0570, 0x0594,
+0x0540, 0x05A0, 0x05A0, 0x05C4, 0x05D0, 0x05DC, 0x05E8, 0x05F4, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0048, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0084,
+0x0060, 0x0150, 0x0168, 0x0174, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0090, 0x00A8, 0x00B4, 0x0000, 0x0000, 0x0000, 0x078C,
+0x0780, 0x0840, 0x0870, 0x0894, 0x0840, 0x08A0, 0x08A0, 0x08C4, 0x08D0, 0x08DC, 0x08E8, 0x08F4,
+0x0600, 0x0600, 0x0600, 0x060C, 0x0600, 0x0600, 0x0600, 0x0654, 0x0600, 0x0600, 0x0600, 0x0624,
+0x0900, 0x1530, 0x15A8, 0x15B4, 0x1500, 0x1500, 0x1500, 0x150C, 0x1500, 0x1500, 0x1530, 0x1554,
+0x1500, 0x15C0, 0x1620, 0x1644, 0x1650, 0x1650, 0x1668, 0x1674, 0x1500, 0x1500, 0x1500, 0x168C,
+0x1680, 0x1680, 0x1680, 0x16D4, 0x1680, 0x1680, 0x1680, 0x16A4, 0x16E0, 0x1710, 0x1728, 0x17F4,
+0x1680, 0x1740, 0x1740, 0x1764, 0x1740, 0x1740, 0x1788, 0x17F4, 0x17A0, 0x17A0, 0x17A0, 0x17C4,
+0x17D0, 0x17DC, 0x17E8, 0x17F4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0048, 0x0054, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0024, 0x0060, 0x0090, 0x00A8, 0x0174,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0030, 0x00A8, 0x00B4, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0030, 0x0114,
+0x00C0, 0x00C0, 0x0120, 0x0144, 0x0150, 0x02DC, 0x02E8, 0x02F4, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0048, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0144,
+0x0120, 0x0150, 0x0168, 0x0174, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0210, 0x0228, 0x0234, 0x0180, 0x0180, 0x0180, 0x024C,
+0x0540, 0x0540, 0x0570, 0x0594, 0x0540, 0x05A0, 0x05A0, 0x05C4, 0x05D0, 0x05DC, 0x05E8, 0x05F4,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0000, 0x0048, 0x00B4, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0084, 0x0060, 0x0150, 0x0168, 0x0174, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0090, 0x00A8, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0240, 0x0270, 0x0294, 0x0240, 0x02A0, 0x02A0, 0x02C4,
+0x02D0, 0x02DC, 0x02E8, 0x02F4, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x00A8, 0x00B4, 0x0000, 0x0000, 0x0000, 0x060C,
+0x0900, 0x0900, 0x0900, 0x0954, 0x0900, 0x09C0, 0x0A20, 0x0A44, 0x0A20, 0x0A50, 0x0A68, 0x0A74,
+0x0900, 0x0900, 0x0900, 0x090C, 0x0900, 0x0A80, 0x0A80, 0x0AD4, 0x0A80, 0x0A80, 0x0A80, 0x0AA4,
+0x0AE0, 0x0B10, 0x0B28, 0x0B34, 0x0A80, 0x0B40, 0x0B40, 0x0B64, 0x0B40, 0x0B40, 0x0B88, 0x0B94,
+0x0BA0, 0x0BA0, 0x0BA0, 0x0BC4, 0x0BD0, 0x0BDC, 0x0BE8, 0x0BF4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0048, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0084,
+0x0060, 0x0090, 0x0168, 0x0174, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0090, 0x00A8, 0x00B4, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x00F0, 0x0114, 0x18C0, 0x1AA0, 0x1AA0, 0x1AC4, 0x1AD0, 0x1ADC, 0x1AE8, 0x1AF4,
+0x1800, 0x1800, 0x1800, 0x180C, 0x1800, 0x1800, 0x1800, 0x1824, 0x1800, 0x1800, 0x1800, 0x1824,
+0x1800, 0x2400, 0x24A8, 0x24B4, 0x2400, 0x2400, 0x2400, 0x240C, 0x2400, 0x2400, 0x2400, 0x2454,
+0x2400, 0x2400, 0x2520, 0x2544, 0x2520, 0x2550, 0x2568, 0x2574, 0x2400, 0x2400, 0x2400, 0x240C,
+0x2700, 0x2700, 0x2700, 0x2754, 0x2700, 0x2880, 0x2880, 0x28A4, 0x28E0, 0x2910, 0x2928, 0x2934,
+0x2880, 0x2880, 0x2940, 0x2964, 0x2940, 0x2940, 0x2988, 0x2994, 0x29A0, 0x29A0, 0x29A0, 0x29C4,
+0x29D0, 0x29DC, 0x29E8, 0x29F4, 0x2400, 0x2400, 0x2400, 0x240C, 0x2400, 0x2400, 0x2400, 0x2424,
+0x2400, 0x2400, 0x2400, 0x2424, 0x2400, 0x2400, 0x2448, 0x24B4, 0x2400, 0x2400, 0x2400, 0x2A0C,
+0x2A00, 0x2A00, 0x2A00, 0x2A54, 0x2A00, 0x2A00, 0x2A00, 0x2A84, 0x2B20, 0x2B50, 0x2B68, 0x2B74,
+0x2A00, 0x2A00, 0x2A00, 0x2A0C, 0x2A00, 0x2A00, 0x2A00, 0x2A54, 0x2A00, 0x2A00, 0x2A00, 0x2A24,
+0x2A00, 0x2A90, 0x2AA8, 0x2AB4, 0x2A00, 0x2B80, 0x2B80, 0x2B8C, 0x2C40, 0x2C40, 0x2C70, 0x2C94,
+0x2C40, 0x2CA0, 0x2CA0, 0x2CC4, 0x8CD0, 0x8CDC, 0x8CE8, 0x8FF4, 0x2A00, 0x2A00, 0x8A00, 0x8A0C,
+0x8D00, 0x8D00, 0x8D00, 0x8D54, 0x8D00, 0x8D00, 0x8D00, 0x8D24, 0x8D00, 0x8D30, 0x8DA8, 0x8DB4,
+0x8D00, 0x8D00, 0x8D00, 0x8D0C, 0x8D00, 0x8D00, 0x8D30, 0x8E14, 0x8DC0, 0x8DC0, 0x8E20, 0x8E44,
+0x8E50, 0x8E5C, 0x8FE8, 0x8FF4, 0x8D00, 0x8E80, 0x8E80, 0x8E8C, 0x8E80, 0x8E80, 0x8E80, 0x8ED4,
+0x8E80, 0x8E80, 0x8E80, 0x8EA4, 0x8EE0, 0x8F10, 0x8F28, 0x8FF4, 0x8F40, 0x8F40, 0x8F40, 0x8F64,
+0x8F40, 0x8F40, 0x8F88, 0x8FF4, 0x8FA0, 0x8FA0, 0x8FA0, 0x8FC4, 0x8FD0, 0x8FDC, 0x8FE8, 0x8FF4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0000, 0x0048, 0x0054, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x6000, 0x6000, 0x6054,
+0x6000, 0x6000, 0x6000, 0x6024, 0x6060, 0x6090, 0x60A8, 0x6174, 0x6000, 0x6000, 0x6000, 0x600C,
+0x6000, 0x6000, 0x6000, 0x6054, 0x6000, 0x6000, 0x6000, 0x6024, 0x6000, 0x6030, 0x60A8, 0x60B4,
+0x6000, 0x6000, 0x6000, 0x600C, 0x6000, 0x6000, 0x6030, 0x6114, 0x60C0, 0x60C0, 0x6120, 0x6144,
+0x6150, 0x615C, 0x62E8, 0x62F4, 0x6000, 0x6000, 0x6000, 0x600C, 0x6000, 0x6000, 0x6000, 0x6024,
+0x6000, 0x6000, 0x6000, 0x6024, 0x6000, 0x6000, 0x6048, 0x60B4, 0x6000, 0x6000, 0x6000, 0x600C,
+0x6000, 0x6000, 0x6000, 0x6054, 0x6000, 0x6000, 0x6000, 0x6144, 0x6120, 0x6150, 0x6168, 0x6174,
+0x6000, 0x6000, 0x6000, 0x600C, 0x6000, 0x6000, 0x6000, 0x6054, 0x6000, 0x6000, 0x6000, 0x6024,
+0x6000, 0x6090, 0x6228, 0x6234, 0x6180, 0x6180, 0x6180, 0x624C, 0x6240, 0x6240, 0x6270, 0x6294,
+0x6540, 0x65A0, 0x65A0, 0x65C4, 0x65D0, 0x65DC, 0x65E8, 0x65F4, 0x6000, 0x6000, 0x6000, 0x6000,
+0x6000, 0x6000, 0x6000, 0x6024, 0x6000, 0x6000, 0x6000, 0x6024, 0x6000, 0x6000, 0x6048, 0x60B4,
+0x6000, 0x6000, 0x6000, 0x600C, 0x6000, 0x6000, 0x6000, 0x6054, 0x6000, 0x6000, 0x6000, 0x6084,
+0x6060, 0x6150, 0x6168, 0x6174, 0x6000, 0x6000, 0x6000, 0x600C, 0x6000, 0x6000, 0x6000, 0x6054,
+0x6000, 0x6000, 0x6000, 0x6024, 0x6000, 0x6090, 0x60A8, 0x60B4, 0x6000, 0x6000, 0x6000, 0x600C,
+0x6000, 0x60C0, 0x6270, 0x6294, 0x6240, 0x62A0, 0x62A0, 0x62C4, 0x62D0, 0x62DC, 0x62E8, 0x62F4,
+0x6000, 0x6000, 0x6000, 0x600C, 0x6000, 0x6000, 0x6000, 0x6024, 0x6000, 0x6000, 0x6000, 0x6024,
+0x6000, 0x6000, 0x60A8, 0x60B4, 0x6000, 0x6000, 0x6000, 0x600C, 0x6000, 0x6000, 0x6000, 0x6054,
+0x6300, 0x63C0, 0x6420, 0x6444, 0x6420, 0x6450, 0x6468, 0x6474, 0x6300, 0x6300, 0x6300, 0x690C,
+0x6900, 0x6900, 0x6A80, 0x6AD4, 0x6A80, 0x6A80, 0x6A80, 0x9AA4, 0x9AE0, 0x9B10, 0x9B28, 0x9B34,
+0x9A80, 0x9B40, 0x9B40, 0x9B64, 0x9B40, 0x9B40, 0x9B88, 0x9B94, 0x9BA0, 0x9BA0, 0x9BA0, 0x9BC4,
+0x9BD0, 0x9BDC, 0x9BE8, 0x9BF4, 0x6000, 0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0x9024,
+0x9000, 0x9000, 0x9000, 0x9024, 0x9000, 0x9000, 0x9048, 0x9054, 0x9000, 0x9000, 0x9000, 0x900C,
+0x9000, 0x9000, 0x9000, 0x9054, 0x9000, 0x9000, 0x9000, 0x9024, 0x9060, 0x9090, 0x9168, 0x9174,
+0x9000, 0x9000, 0x9000, 0x900C, 0x9000, 0x9000, 0x9000, 0x9054, 0x9000, 0x9000, 0x9000, 0x9024,
+0x9000, 0x9030, 0x90A8, 0x90B4, 0x9000, 0x9000, 0x9000, 0x900C, 0x9000, 0x9000, 0x90F0, 0x9114,
+0x90C0, 0x90C0, 0x92A0, 0x92C4, 0x92D0, 0x92DC, 0x92E8, 0x92F4, 0x9000, 0x9000, 0x9000, 0x900C,
+0x9000, 0x9000, 0x9000, 0x9024, 0x9000, 0x9000, 0x9000, 0x9024, 0x9000, 0x9000, 0x9048, 0x90B4,
+0x9000, 0x9000, 0x9000, 0x900C, 0x9000, 0x9000, 0x9000, 0x9054, 0x9000, 0x9000, 0x90C0, 0x9144,
+0x9120, 0x9150, 0x9168, 0x9174, 0x9000, 0x9000, 0x9000, 0x900C, 0x9000, 0x9000, 0x9000, 0x9054,
+0x9300, 0x9300, 0x9480, 0x94A4, 0x9480, 0x9510, 0x9528, 0x9534, 0x9480, 0x9480, 0x9540, 0x9564,
+0x9540, 0x9540, 0x9588, 0x9594, 0x9540, 0x95A0, 0x95A0, 0x95C4, 0x95D0, 0x95DC, 0x95E8, 0x95F4,
+0x9000, 0x9000, 0x9000, 0x900C, 0x9000, 0x9000, 0x9000, 0x9024, 0x9000, 0x9000, 0x9000, 0x9024,
+0x9000, 0x9C00, 0x9C48, 0x9CB4, 0x9C00, 0x9C00, 0x9C00, 0x9C0C, 0x9C00, 0x9C00, 0x9C00, 0x9C54,
+0x9C00, 0x9C00, 0x9C00, 0x9C84, 0x9D20, 0x9D50, 0x9D68, 0x9D74, 0x9C00, 0x9C00, 0x9C00, 0xA20C,
+0xA200, 0xA200, 0xA200, 0xA254, 0xA200, 0xA200, 0xA200, 0xA224, 0xA200, 0xA290, 0xA2A8, 0xA2B4,
+0xA200, 0xA200, 0xA380, 0xA38C, 0xA440, 0xA440, 0xA470, 0xA494, 0xA440, 0xA4A0, 0xA4A0, 0xA4C4,
+0xA4D0, 0xA4DC, 0xA4E8, 0xA4F4, 0xA200, 0xA200, 0xA200, 0xA20C, 0xA200, 0xA200, 0xA200, 0xA254,
+0xA500, 0xA500, 0xA500, 0xA524, 0xA500, 0xA530, 0xA5A8, 0xA5B4, 0xA500, 0xA500, 0xA500, 0xA50C,
+0xA500, 0xA500, 0xA530, 0xA554, 0xA5C0, 0xA5C0, 0xA620, 0xA644, 0xA650, 0xA650, 0xA668, 0xA7F4,
+0xA500, 0xA500, 0xA680, 0xA68C, 0xA680, 0xA680, 0xA680, 0xA6D4, 0xA680, 0xA680, 0xA680, 0xA6A4,
+0xA6E0, 0xA710, 0xA728, 0xA7F4, 0xA740, 0xA740, 0xA740, 0xA764, 0xA740, 0xA740, 0xA788, 0xA7F4,
+0xA7A0, 0xA7A0, 0xA7A0, 0xA7C4, 0xA7D0, 0xA7DC, 0xA7E8, 0xA7F4, 0x9000, 0x9000, 0x9000, 0x9000,
+0x9000, 0x9000, 0x9000, 0x9024, 0x9000, 0x9000, 0x9000, 0x9024, 0x9000, 0x9000, 0x9048, 0x9054,
+0x9000, 0x9000, 0x9000, 0x900C, 0x9000, 0x9000, 0x9000, 0x9054, 0x9000, 0x9000, 0x9000, 0x9024,
+0x9060, 0x9090, 0x90A8, 0x9174, 0x9000, 0x9000, 0x9000, 0x900C, 0x9000, 0x9000, 0x9000, 0x9054,
+0x9000, 0x9000, 0x9000, 0x9024, 0x9000, 0x9030, 0x90A8, 0x90B4, 0x9000, 0x9000, 0x9000, 0x900C,
+0x9000, 0x9000, 0x9030, 0x9114, 0xA8C0, 0xA8C0, 0xA920, 0xA944, 0xAAD0, 0xAADC, 0xAAE8, 0xAAF4,
+0xA800, 0xA800, 0xA800, 0xA80C, 0xA800, 0xA800, 0xA800, 0xA824, 0xA800, 0xA800, 0xA800, 0xA824,
+0xA800, 0xA800, 0xA848, 0xA8B4, 0xA800, 0xA800, 0xA800, 0xA80C, 0xA800, 0xA800, 0xA800, 0xA854,
+0xA800, 0xA800, 0xA800, 0xA944, 0xA920, 0xA950, 0xA968, 0xA974, 0xA800, 0xA800, 0xA800, 0xA80C,
+0xA800, 0xA800, 0xA800, 0xA854, 0xA800, 0xA800, 0xA800, 0xA824, 0xA980, 0xAA10, 0xAA28, 0xAD34,
+0xAC80, 0xAC80, 0xAC80, 0xAD4C, 0xAD40, 0xAD40, 0xAD70, 0xAD94, 0xAD40, 0xADA0, 0xADA0, 0xADC4,
+0xADD0, 0xADDC, 0xADE8, 0xADF4, 0xA800, 0xA800, 0xA800, 0xA80C, 0xA800, 0xA800, 0xA800, 0xA824,
+0xA800, 0xA800, 0xA800, 0xA824, 0xA800, 0xA800, 0xA848, 0xA8B4, 0xA800, 0xA800, 0xA800, 0xA80C,
+0xA800, 0xA800, 0xA800, 0xA854, 0xA800, 0xA800, 0xA800, 0xA884, 0xA860, 0xA950, 0xA968, 0xA974,
+0xA800, 0xA800, 0xA800, 0xA80C, 0xA800, 0xA800, 0xA800, 0xA854, 0xA800, 0xA800, 0xA800, 0xA824,
+0xA800, 0xA890, 0xA8A8, 0xA8B4, 0xA800, 0xA800, 0xA800, 0xA80C, 0xA980, 0xAA40, 0xAA70, 0xAA94,
+0xAA40, 0xAAA0, 0xAAA0, 0xAAC4, 0xAAD0, 0xB0DC, 0xB0E8, 0xB0F4, 0xA800, 0xA800, 0xA800, 0xAE0C,
+0xAE00, 0xAE00, 0xAE00, 0xAE24, 0xAE00, 0xAE00, 0xAE00, 0xAE24, 0xAE00, 0xAE00, 0xAEA8, 0xB1B4,
+0xB100, 0xB100, 0xB100, 0xB10C, 0xB100, 0xB100, 0xB100, 0xB154, 0xB100, 0xB1C0, 0xB220, 0xB244,
+0xB220, 0xB250, 0xB268, 0xB274, 0xB100, 0xB100, 0xB100, 0xB10C, 0xB280, 0xB280, 0xB280, 0xB2D4,
+0xB280, 0xB280, 0xB280, 0xB2A4, 0xB2E0, 0xB310, 0xB328, 0xB334, 0xB280, 0xB340, 0xB340, 0xB364,
+0xB340, 0xB340, 0xB388, 0xBFF4, 0xBFA0, 0xBFA0, 0xBFA0, 0xBFC4, 0xBFD0, 0xBFDC, 0xBFE8, 0xBFF4,
+0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA824, 0xA800, 0xA800, 0xA800, 0xA824,
+0xA800, 0xB400, 0xB448, 0xB4B4, 0xB400, 0xB400, 0xB400, 0xB40C, 0xB400, 0xB400, 0xB400, 0xB454,
+0xB400, 0xB400, 0xB400, 0xB484, 0xB460, 0xB490, 0xB568, 0xB574, 0xB400, 0xB400, 0xB400, 0xB40C,
+0xB400, 0xB400, 0xB400, 0xB454, 0xB400, 0xB400, 0xB400, 0xB424, 0xB400, 0xB490, 0xB4A8, 0xB4B4,
+0xB400, 0xB400, 0xB400, 0xB40C, 0xB400, 0xB400, 0xB4F0, 0xB694, 0xB640, 0xB6A0, 0xB6A0, 0xB6C4,
+0xB6D0, 0xB6DC, 0xB6E8, 0xB6F4, 0xB400, 0xB400, 0xB400, 0xB40C, 0xB400, 0xB400, 0xB400, 0xB424,
+0xB400, 0xB400, 0xB400, 0xB424, 0xB400, 0xB400, 0xB4A8, 0xB4B4, 0xB400, 0xB400, 0xB400, 0xB40C,
+0xB400, 0xB400, 0xB400, 0xB454, 0xB400, 0xB400, 0xB520, 0xB544, 0xB520, 0xB550, 0xB868, 0xB874,
+0xB700, 0xB700, 0xB700, 0xB70C, 0xB700, 0xB700, 0xB700, 0xB8D4, 0xB880, 0xB880, 0xB880, 0xB8A4,
+0xB8E0, 0xB910, 0xB928, 0xB934, 0xB880, 0xB880, 0xB940, 0xB964, 0xB940, 0xB940, 0xB988, 0xB994,
+0xBFA0, 0xBFA0, 0xBFA0, 0xBFC4, 0xBFD0, 0xBFDC, 0xBFE8, 0xBFF4, 0xB400, 0xB400, 0xB400, 0xBA0C,
+0xBA00, 0xBA00, 0xBA00, 0xBA24, 0xBA00, 0xBA00, 0xBA00, 0xBA24, 0xBA00, 0xBA00, 0xBA48, 0xBAB4,
+0xBA00, 0xBA00, 0xBA00, 0xBA0C, 0xBA00, 0xBA00, 0xBA00, 0xBA54, 0xBA00, 0xBA00, 0xBA00, 0xBA84,
+0xBB20, 0xBB50, 0xBB68, 0xBB74, 0xBA00, 0xBA00, 0xBA00, 0xBA0C, 0xBA00, 0xBA00, 0xBA00, 0xBA54,
+0xBA00, 0xBA00, 0xBA00, 0xBA24, 0xBA00, 0xBA90, 0xBAA8, 0xBC34, 0xBB80, 0xBB80, 0xBB80, 0xBB8C,
+0xBC40, 0xBC40, 0xBC70, 0xBC94, 0xBC40, 0xBCA0, 0xBCA0, 0xBFC4, 0xBFD0, 0xBFDC, 0xBFE8, 0xBFF4,
+0xBD00, 0xBD00, 0xBD00, 0xBD0C, 0xBD00, 0xBD00, 0xBD00, 0xBD54, 0xBD00, 0xBD00, 0xBD00, 0xBD24,
+0xBD00, 0xBD30, 0xBDA8, 0xBDB4, 0xBD00, 0xBD00, 0xBD00, 0xBD0C, 0xBD00, 0xBD00, 0xBD30, 0xBE14,
+0xBDC0, 0xBDC0, 0xBE20, 0xBE44, 0xBE50, 0xBFDC, 0xBFE8, 0xBFF4, 0xBE80, 0xBE80, 0xBE80, 0xBE8C,
+0xBE80, 0xBE80, 0xBE80, 0xBED4, 0xBE80, 0xBE80, 0xBE80, 0xBEA4, 0xBEE0, 0xBF10, 0xBF28, 0xBFF4,
+0xBF40, 0xBF40, 0xBF40, 0xBF64, 0xBF40, 0xBF40, 0xBF88, 0xBFF4, 0xBFA0, 0xBFA0, 0xBFA0, 0xBFC4,
+0xBFD0, 0xBFDC, 0xBFE8, 0xBFF4
+};
+
+// bitmul=0.8, bitstrength=2.5, threshold=0.64
+const uint16_t PulseTriSaw_8580[4096] =
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0048, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0120, 0x0120, 0x0150, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0048, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x00C0, 0x0240, 0x0240, 0x0240, 0x02A0, 0x02A0, 0x02D0, 0x02F4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0048,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0120, 0x0120, 0x0150, 0x0174,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0048, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0060, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0498, 0x0540, 0x0540, 0x0540, 0x0540,
+0x05A0, 0x05A0, 0x05D0, 0x05F4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0048, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0120, 0x0120, 0x0150, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0048,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0198, 0x0240, 0x0240, 0x0240, 0x0240, 0x02A0, 0x02A0, 0x02D0, 0x02F4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0048, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x00C0,
+0x0120, 0x0120, 0x0150, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0048, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0060, 0x0090, 0x00B4,
+0x0600, 0x0900, 0x0900, 0x0900, 0x0900, 0x0900, 0x0900, 0x0918, 0x0900, 0x0900, 0x0900, 0x0900,
+0x0900, 0x0900, 0x0900, 0x0954, 0x0A80, 0x0A80, 0x0A80, 0x0A80, 0x0A80, 0x0A80, 0x0A80, 0x0A98,
+0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0BA0, 0x0BA0, 0x0BD0, 0x0BF4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0048,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0120, 0x0120, 0x0150, 0x0174,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0048, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0240, 0x0240, 0x0240, 0x0240,
+0x02A0, 0x02A0, 0x02D0, 0x02F4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0048, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x00C0, 0x0120, 0x0120, 0x0150, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0048,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0060, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0300, 0x0354, 0x0480, 0x0480, 0x0480, 0x0480,
+0x0480, 0x0480, 0x0480, 0x0498, 0x0540, 0x0540, 0x0540, 0x0540, 0x05A0, 0x05A0, 0x05D0, 0x05F4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0048, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0120, 0x0120, 0x0150, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0048, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0180, 0x0180, 0x0198,
+0x0240, 0x0240, 0x0240, 0x0240, 0x02A0, 0x02A0, 0x02D0, 0x02F4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0048,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x00C0, 0x00C0, 0x0120, 0x0120, 0x0150, 0x0174,
+0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200,
+0x1200, 0x1200, 0x1200, 0x1248, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1218,
+0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1260, 0x1290, 0x12B4, 0x1500, 0x1500, 0x1500, 0x1500,
+0x1500, 0x1500, 0x1500, 0x1518, 0x1500, 0x1500, 0x1500, 0x1500, 0x1500, 0x1500, 0x1500, 0x1554,
+0x1680, 0x1680, 0x1680, 0x1680, 0x1680, 0x1680, 0x1680, 0x1698, 0x1740, 0x1740, 0x1740, 0x1740,
+0x17A0, 0x17A0, 0x17D0, 0x17F4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0048, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0120, 0x0120, 0x0150, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0048,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0240, 0x0240, 0x0240, 0x0240, 0x02A0, 0x02A0, 0x02D0, 0x02F4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0048, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x00C0,
+0x0120, 0x0120, 0x0150, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0048, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0060, 0x0090, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0498,
+0x0540, 0x0540, 0x0540, 0x0540, 0x05A0, 0x05A0, 0x05D0, 0x05F4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0048,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0120, 0x0120, 0x0150, 0x0174,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0048, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0180, 0x0198, 0x0240, 0x0240, 0x0240, 0x0240,
+0x02A0, 0x02A0, 0x02D0, 0x02F4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0048, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x00C0, 0x00C0, 0x0120, 0x0120, 0x0150, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0048,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0600, 0x0600,
+0x0600, 0x0660, 0x0690, 0x06B4, 0x0900, 0x0900, 0x0900, 0x0900, 0x0900, 0x0900, 0x0900, 0x0918,
+0x0900, 0x0900, 0x0900, 0x0900, 0x0900, 0x0900, 0x0900, 0x0954, 0x0A80, 0x0A80, 0x0A80, 0x0A80,
+0x0A80, 0x0A80, 0x0A80, 0x0A98, 0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0BA0, 0x0BA0, 0x0BD0, 0x0BF4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0048, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0120, 0x0120, 0x0150, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0048, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0240, 0x0240, 0x0240, 0x0240, 0x02A0, 0x02A0, 0x02D0, 0x02F4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0048,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x00C0, 0x0120, 0x0120, 0x0150, 0x0174,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0048, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0060, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0354,
+0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0498, 0x0540, 0x0540, 0x0540, 0x0540,
+0x05A0, 0x05A0, 0x05D0, 0x05F4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0048, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0120, 0x0120, 0x0150, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0048,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0180, 0x0180, 0x0180, 0x0198, 0x0240, 0x0240, 0x0240, 0x0240, 0x02A0, 0x02A0, 0x02D0, 0x02F4,
+0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+0x2400, 0x2400, 0x2400, 0x2448, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2418,
+0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2490, 0x24B4, 0x2400, 0x2400, 0x2400, 0x2400,
+0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2454,
+0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2418, 0x2400, 0x2400, 0x24C0, 0x24C0,
+0x2520, 0x2520, 0x2550, 0x2574, 0x2A00, 0x2A00, 0x2A00, 0x2A00, 0x2A00, 0x2A00, 0x2A00, 0x2A00,
+0x2A00, 0x2A00, 0x2A00, 0x2A00, 0x2A00, 0x2A00, 0x2A00, 0x2A48, 0x2A00, 0x2A00, 0x2A00, 0x2A00,
+0x2A00, 0x2A00, 0x2A00, 0x2A18, 0x2A00, 0x2A00, 0x2A00, 0x2A00, 0x2A00, 0x2A60, 0x2A90, 0x2AB4,
+0x2D00, 0x2D00, 0x2D00, 0x2D00, 0x2D00, 0x2D00, 0x2D00, 0x2D18, 0x2D00, 0x2D00, 0x2D00, 0x2D00,
+0x2D00, 0x2D00, 0x2D00, 0x2D54, 0x2E80, 0x2E80, 0x2E80, 0x2E80, 0x2E80, 0x2E80, 0x2E80, 0x2E98,
+0x2F40, 0x2F40, 0x2F40, 0x2F40, 0x2FA0, 0x2FA0, 0x2FD0, 0x2FF4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0048,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0120, 0x0120, 0x0150, 0x0174,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0048, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0240, 0x0240, 0x0240, 0x0240,
+0x02A0, 0x02A0, 0x02D0, 0x02F4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0048, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0120, 0x0120, 0x0150, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0048,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0060, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0480, 0x0480, 0x0480, 0x0480,
+0x0480, 0x0480, 0x0480, 0x0498, 0x0540, 0x0540, 0x0540, 0x0540, 0x05A0, 0x05A0, 0x05D0, 0x05F4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0048, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0120, 0x0120, 0x0150, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0048, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0198,
+0x0240, 0x0240, 0x0240, 0x0240, 0x02A0, 0x02A0, 0x02D0, 0x02F4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0048,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x00C0, 0x0120, 0x0120, 0x0150, 0x0174,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0048, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0060, 0x0090, 0x00B4, 0x0900, 0x0900, 0x0900, 0x0900,
+0x0900, 0x0900, 0x0900, 0x0918, 0x0900, 0x0900, 0x0900, 0x0900, 0x0900, 0x0900, 0x0900, 0x0954,
+0x0A80, 0x0A80, 0x0A80, 0x0A80, 0x0A80, 0x0A80, 0x0A80, 0x0A98, 0x0B40, 0x0B40, 0x0B40, 0x0B40,
+0x0BA0, 0x0BA0, 0x0BD0, 0x0BF4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0048, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0120, 0x0120, 0x0150, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0048,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0240, 0x0240, 0x0240, 0x0240, 0x02A0, 0x02A0, 0x02D0, 0x02F4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0048, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x00C0,
+0x0120, 0x0120, 0x0150, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0048, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0060, 0x0090, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0300, 0x0300, 0x0300, 0x0354, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0498,
+0x0540, 0x0540, 0x0540, 0x0540, 0x05A0, 0x05A0, 0x05D0, 0x05F4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0048,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0120, 0x0120, 0x0150, 0x0174,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0048, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0180, 0x0180, 0x0198, 0x0240, 0x0240, 0x0240, 0x0240,
+0x02A0, 0x02A0, 0x02D0, 0x02F4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0048, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C18,
+0x0C00, 0x0C00, 0x0CC0, 0x0CC0, 0x0D20, 0x0D20, 0x0D50, 0x0D74, 0x1200, 0x1200, 0x1200, 0x1200,
+0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1248,
+0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1218, 0x1200, 0x1200, 0x1200, 0x1200,
+0x1200, 0x1260, 0x1290, 0x12B4, 0x1500, 0x1500, 0x1500, 0x1500, 0x1500, 0x1500, 0x1500, 0x1518,
+0x1500, 0x1500, 0x1500, 0x1500, 0x1500, 0x1500, 0x1500, 0x1554, 0x1680, 0x1680, 0x1680, 0x1680,
+0x1680, 0x1680, 0x1680, 0x1698, 0x1740, 0x1740, 0x1740, 0x1740, 0x17A0, 0x17A0, 0x17D0, 0x17F4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0048, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0120, 0x0120, 0x0150, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0048, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0240, 0x0240, 0x0240, 0x0240, 0x02A0, 0x02A0, 0x02D0, 0x02F4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0048,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x00C0, 0x0120, 0x0120, 0x0150, 0x0174,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0048, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0060, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0498, 0x0540, 0x0540, 0x0540, 0x0540,
+0x05A0, 0x05A0, 0x05D0, 0x05F4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0048, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0120, 0x0120, 0x0150, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0048,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0180, 0x0198, 0x0240, 0x0240, 0x0240, 0x0240, 0x02A0, 0x02A0, 0x02D0, 0x02F4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0048, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x00C0, 0x00C0,
+0x0120, 0x0120, 0x0150, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0048, 0x0000, 0x0000, 0x0600, 0x0600,
+0x0600, 0x0600, 0x0600, 0x0618, 0x0600, 0x0600, 0x0600, 0x0600, 0x0600, 0x0660, 0x0690, 0x06B4,
+0x0900, 0x0900, 0x0900, 0x0900, 0x0900, 0x0900, 0x0900, 0x0918, 0x0900, 0x0900, 0x0900, 0x0900,
+0x0900, 0x0900, 0x0900, 0x0954, 0x0A80, 0x0A80, 0x0A80, 0x0A80, 0x0A80, 0x0A80, 0x0A80, 0x0A98,
+0x0B40, 0x0B40, 0x0B40, 0x0B40, 0x0BA0, 0x0BA0, 0x0BD0, 0x0BF4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0048,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0090, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0120, 0x0120, 0x0150, 0x0174,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0048, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x00B4, 0x3000, 0x3000, 0x3000, 0x3000,
+0x3000, 0x3000, 0x3000, 0x3018, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3054,
+0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3018, 0x3240, 0x3240, 0x3240, 0x3240,
+0x32A0, 0x32A0, 0x32D0, 0x32F4, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3048, 0x3000, 0x3000, 0x3000, 0x3000,
+0x3000, 0x3000, 0x3000, 0x3018, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3090, 0x30B4,
+0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+0x3000, 0x3000, 0x3000, 0x3054, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3018,
+0x3000, 0x3000, 0x3000, 0x30C0, 0x3120, 0x3120, 0x3150, 0x3174, 0x3000, 0x3000, 0x3000, 0x3000,
+0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3048,
+0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3018, 0x3000, 0x3000, 0x3000, 0x3000,
+0x3000, 0x3060, 0x3090, 0x30B4, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3018,
+0x3300, 0x3300, 0x3300, 0x3300, 0x3300, 0x3300, 0x3300, 0x3354, 0x3480, 0x3480, 0x3480, 0x3480,
+0x3480, 0x3480, 0x3480, 0x3498, 0x3540, 0x3540, 0x3540, 0x3540, 0x35A0, 0x35A0, 0x35D0, 0x35F4,
+0x4800, 0x4800, 0x4800, 0x4800, 0x4800, 0x4800, 0x4800, 0x4800, 0x4800, 0x4800, 0x4800, 0x4800,
+0x4800, 0x4800, 0x4800, 0x4848, 0x4800, 0x4800, 0x4800, 0x4800, 0x4800, 0x4800, 0x4800, 0x4818,
+0x4800, 0x4800, 0x4800, 0x4800, 0x4800, 0x4800, 0x4890, 0x48B4, 0x4800, 0x4800, 0x4800, 0x4800,
+0x4800, 0x4800, 0x4800, 0x4800, 0x4800, 0x4800, 0x4800, 0x4800, 0x4800, 0x4800, 0x4800, 0x4854,
+0x4800, 0x4800, 0x4800, 0x4800, 0x4800, 0x4800, 0x4800, 0x4818, 0x4800, 0x4800, 0x4800, 0x4800,
+0x4920, 0x4920, 0x4950, 0x4974, 0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA800,
+0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA848, 0xA800, 0xA800, 0xA800, 0xA800,
+0xA800, 0xA800, 0xA800, 0xA818, 0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA890, 0xA8B4,
+0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA818, 0xA800, 0xA800, 0xA800, 0xA800,
+0xA800, 0xA800, 0xA800, 0xA854, 0xA800, 0xA800, 0xA800, 0xA800, 0xA980, 0xA980, 0xA980, 0xA998,
+0xAA40, 0xAA40, 0xAA40, 0xAA40, 0xAAA0, 0xAAA0, 0xAAD0, 0xAAF4, 0xB400, 0xB400, 0xB400, 0xB400,
+0xB400, 0xB400, 0xB400, 0xB400, 0xB400, 0xB400, 0xB400, 0xB400, 0xB400, 0xB400, 0xB400, 0xB448,
+0xB400, 0xB400, 0xB400, 0xB400, 0xB400, 0xB400, 0xB400, 0xB418, 0xB400, 0xB400, 0xB400, 0xB400,
+0xB400, 0xB400, 0xB490, 0xB4B4, 0xB400, 0xB400, 0xB400, 0xB400, 0xB400, 0xB400, 0xB400, 0xB400,
+0xB400, 0xB400, 0xB400, 0xB400, 0xB400, 0xB400, 0xB400, 0xB454, 0xB400, 0xB400, 0xB400, 0xB400,
+0xB400, 0xB400, 0xB400, 0xB418, 0xB400, 0xB400, 0xB4C0, 0xB4C0, 0xB520, 0xB520, 0xB550, 0xB574,
+0xBA00, 0xBA00, 0xBA00, 0xBA00, 0xBA00, 0xBA00, 0xBA00, 0xBA00, 0xBA00, 0xBA00, 0xBA00, 0xBA00,
+0xBA00, 0xBA00, 0xBA00, 0xBA48, 0xBA00, 0xBA00, 0xBA00, 0xBA00, 0xBA00, 0xBA00, 0xBA00, 0xBA18,
+0xBA00, 0xBA00, 0xBA00, 0xBA00, 0xBA00, 0xBA60, 0xBA90, 0xBAB4, 0xBD00, 0xBD00, 0xBD00, 0xBD00,
+0xBD00, 0xBD00, 0xBD00, 0xBD18, 0xBD00, 0xBD00, 0xBD00, 0xBD00, 0xBD00, 0xBD00, 0xBD00, 0xBD54,
+0xBE80, 0xBE80, 0xBE80, 0xBE80, 0xBE80, 0xBE80, 0xBE80, 0xBE98, 0xBF40, 0xBF40, 0xBF40, 0xBF40,
+0xBFA0, 0xBFA0, 0xBFD0, 0xBFF4
+};
+
+// far from "correct" but at least a bit better than Hermit's use of PulseSaw_8580 (see
+// Last_Ninja) - improved settings are welcome!
+// bitmul=0.8, bitstrength=1.5, threshold=0.38
+const uint16_t PulseTri_8580[4096] =
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0030, 0x00A8, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0048, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0174,
+0x0120, 0x015C, 0x0168, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0030, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0084, 0x0000, 0x015C, 0x0168, 0x0174,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0090, 0x00A8, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0240, 0x0288, 0x02F4,
+0x0240, 0x02A0, 0x02A0, 0x02F4, 0x02D0, 0x02F4, 0x02E8, 0x05F4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x009C, 0x00A8, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0030, 0x00A8, 0x00B4, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x0030, 0x0174, 0x0000, 0x00C0, 0x0120, 0x02F4, 0x02D0, 0x02F4, 0x02E8, 0x02F4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0000, 0x0048, 0x00B4, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0174, 0x0120, 0x0174, 0x0168, 0x05F4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0300, 0x0504, 0x0480, 0x051C, 0x05E8, 0x05F4,
+0x0480, 0x0480, 0x0480, 0x0564, 0x0540, 0x0570, 0x05E8, 0x05F4, 0x0540, 0x05A0, 0x05A0, 0x0BF4,
+0x0BD0, 0x0BF4, 0x0BE8, 0x0BF4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x009C, 0x00A8, 0x0174,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0000, 0x00A8, 0x00B4, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0174,
+0x0000, 0x00C0, 0x0120, 0x0174, 0x0120, 0x02F4, 0x02E8, 0x02F4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0048, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0174,
+0x0120, 0x015C, 0x0168, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x021C, 0x0228, 0x05F4, 0x0000, 0x0180, 0x0180, 0x0564,
+0x0240, 0x0540, 0x05E8, 0x05F4, 0x0540, 0x05A0, 0x05A0, 0x05F4, 0x05D0, 0x05F4, 0x05E8, 0x05F4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x0030, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0084, 0x0060, 0x015C, 0x0168, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x009C, 0x00A8, 0x02F4,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0240, 0x0288, 0x02F4, 0x0240, 0x02A0, 0x02A0, 0x08F4,
+0x08D0, 0x0BF4, 0x0BE8, 0x0BF4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0630, 0x06A8, 0x09B4, 0x0000, 0x0000, 0x0000, 0x090C,
+0x0600, 0x0900, 0x0930, 0x0A74, 0x0900, 0x09C0, 0x0A20, 0x0BF4, 0x0BD0, 0x0BF4, 0x0BE8, 0x0BF4,
+0x0900, 0x0900, 0x0900, 0x090C, 0x0900, 0x0A80, 0x0A80, 0x0AD4, 0x0A80, 0x0A80, 0x0A80, 0x0BC4,
+0x0AE0, 0x17DC, 0x17E8, 0x17F4, 0x0A80, 0x1740, 0x1740, 0x1764, 0x1740, 0x17D0, 0x17E8, 0x17F4,
+0x17A0, 0x17A0, 0x17A0, 0x17F4, 0x17D0, 0x17F4, 0x17E8, 0x17F4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x009C, 0x00A8, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x00A8, 0x00B4, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x0000, 0x0114, 0x0000, 0x0000, 0x0120, 0x0174, 0x0120, 0x0174, 0x02E8, 0x02F4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x0030, 0x00B4, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0144, 0x0060, 0x015C, 0x0168, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x009C, 0x0228, 0x02F4,
+0x0000, 0x0000, 0x0000, 0x0264, 0x0180, 0x0240, 0x0288, 0x05F4, 0x0240, 0x05A0, 0x05A0, 0x05F4,
+0x05D0, 0x05F4, 0x05E8, 0x05F4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0030, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0084, 0x0000, 0x015C, 0x0168, 0x0174,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0090, 0x00A8, 0x00B4, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x00C0, 0x0270, 0x02F4,
+0x00C0, 0x02A0, 0x02A0, 0x02F4, 0x02D0, 0x02F4, 0x02E8, 0x05F4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x00A8, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0474, 0x0000, 0x03C0, 0x0420, 0x0A74,
+0x0A20, 0x0BF4, 0x0BE8, 0x0BF4, 0x0000, 0x0000, 0x0300, 0x030C, 0x0300, 0x0900, 0x0A80, 0x0AD4,
+0x0900, 0x0A80, 0x0A80, 0x0B04, 0x0AE0, 0x0BDC, 0x0BE8, 0x0BF4, 0x0A80, 0x0B40, 0x0B40, 0x0B64,
+0x0B40, 0x0BD0, 0x0BE8, 0x0BF4, 0x0BA0, 0x0BA0, 0x0BA0, 0x0BF4, 0x0BD0, 0x0BF4, 0x0BE8, 0x0BF4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x009C, 0x0168, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0030, 0x00A8, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x00F0, 0x02F4, 0x0000, 0x00C0, 0x02A0, 0x02F4,
+0x02D0, 0x02F4, 0x02E8, 0x02F4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0048, 0x00B4, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x00C0, 0x0174, 0x0120, 0x0474, 0x05E8, 0x05F4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04D4, 0x0000, 0x0300, 0x0480, 0x0504,
+0x0480, 0x11DC, 0x11E8, 0x11F4, 0x0480, 0x1080, 0x1140, 0x1164, 0x1140, 0x1170, 0x17E8, 0x17F4,
+0x1140, 0x17A0, 0x17A0, 0x17F4, 0x17D0, 0x17F4, 0x17E8, 0x17F4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0048, 0x0CB4,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0C00, 0x0C00, 0x0C54, 0x0C00, 0x0C00, 0x0C00, 0x1344,
+0x1320, 0x135C, 0x1368, 0x1374, 0x0000, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x1200, 0x1200, 0x1254,
+0x1200, 0x1200, 0x1200, 0x1224, 0x1200, 0x141C, 0x1428, 0x2FF4, 0x1200, 0x1200, 0x1380, 0x2C64,
+0x1440, 0x2F40, 0x2F88, 0x2FF4, 0x2F40, 0x2FA0, 0x2FA0, 0x2FF4, 0x2FD0, 0x2FF4, 0x2FE8, 0x2FF4,
+0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x2A00, 0x2D54, 0x1200, 0x2D00, 0x2D00, 0x2D24,
+0x2D00, 0x2D90, 0x2DA8, 0x2DB4, 0x2D00, 0x2D00, 0x2D00, 0x2D0C, 0x2D00, 0x2D00, 0x2F70, 0x2FF4,
+0x2DC0, 0x2FA0, 0x2FA0, 0x2FF4, 0x2FD0, 0x2FF4, 0x2FE8, 0x2FF4, 0x2D00, 0x2D00, 0x2E80, 0x2E8C,
+0x2E80, 0x2E80, 0x2E80, 0x2ED4, 0x2E80, 0x2E80, 0x2E80, 0x2FF4, 0x2FA0, 0x2FF4, 0x2FE8, 0x2FF4,
+0x2F40, 0x2F40, 0x2F40, 0x2F64, 0x2F40, 0x2FDC, 0x2FE8, 0x2FF4, 0x2FA0, 0x2FA0, 0x2FD0, 0x2FF4,
+0x2FD0, 0x2FF4, 0x2FE8, 0x2FF4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0090, 0x00A8, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0000, 0x0048, 0x00B4, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0174, 0x0120, 0x0174, 0x0168, 0x02F4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0030, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0084,
+0x0060, 0x015C, 0x0168, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x009C, 0x00A8, 0x02F4, 0x0000, 0x0000, 0x0000, 0x01A4,
+0x0180, 0x0240, 0x0288, 0x02F4, 0x0240, 0x02A0, 0x02A0, 0x05F4, 0x05D0, 0x05F4, 0x05E8, 0x05F4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x0000, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0084, 0x0000, 0x009C, 0x0168, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0090, 0x00A8, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x00F0, 0x02F4, 0x0000, 0x02A0, 0x02A0, 0x02F4,
+0x02D0, 0x02F4, 0x02E8, 0x02F4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x00A8, 0x00B4, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x0000, 0x0114, 0x0000, 0x0000, 0x0120, 0x0474, 0x0420, 0x05F4, 0x05E8, 0x0BF4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0300, 0x0300, 0x04D4, 0x0300, 0x0480, 0x0480, 0x0B04,
+0x0AE0, 0x0BDC, 0x0BE8, 0x0BF4, 0x0480, 0x0A80, 0x0B40, 0x0B64, 0x0B40, 0x0B70, 0x0BE8, 0x0BF4,
+0x0BA0, 0x0BA0, 0x0BA0, 0x0BF4, 0x0BD0, 0x0BF4, 0x0BE8, 0x0BF4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x009C, 0x00A8, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0030, 0x00A8, 0x00B4, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x0030, 0x0174, 0x0000, 0x00C0, 0x0120, 0x02F4, 0x02D0, 0x02F4, 0x02E8, 0x02F4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0000, 0x0048, 0x00B4, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0174, 0x0120, 0x015C, 0x0168, 0x05F4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0504, 0x0480, 0x051C, 0x05E8, 0x05F4,
+0x0180, 0x0480, 0x0480, 0x0564, 0x0540, 0x0570, 0x05E8, 0x05F4, 0x0540, 0x05A0, 0x05A0, 0x05F4,
+0x05D0, 0x17F4, 0x17E8, 0x17F4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0030, 0x00B4, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0144, 0x0060, 0x015C, 0x0168, 0x0774,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0624,
+0x0600, 0x129C, 0x1428, 0x14F4, 0x0000, 0x1200, 0x1200, 0x1464, 0x1380, 0x1440, 0x1488, 0x17F4,
+0x1440, 0x17A0, 0x17A0, 0x17F4, 0x17D0, 0x17F4, 0x17E8, 0x17F4, 0x0000, 0x0000, 0x0000, 0x1200,
+0x1200, 0x1200, 0x1200, 0x1254, 0x1200, 0x1200, 0x1200, 0x1524, 0x1500, 0x1590, 0x15A8, 0x15B4,
+0x1200, 0x1500, 0x1500, 0x150C, 0x1500, 0x1500, 0x15F0, 0x17F4, 0x1500, 0x17A0, 0x17A0, 0x17F4,
+0x17D0, 0x17F4, 0x17E8, 0x17F4, 0x1500, 0x1500, 0x1500, 0x168C, 0x1680, 0x1680, 0x1680, 0x16D4,
+0x1680, 0x1680, 0x1680, 0x17F4, 0x17A0, 0x17DC, 0x17E8, 0x17F4, 0x1680, 0x1740, 0x1740, 0x1764,
+0x1740, 0x17DC, 0x17E8, 0x2FF4, 0x17A0, 0x2FA0, 0x2FD0, 0x2FF4, 0x2FD0, 0x2FF4, 0x2FE8, 0x5FF4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x009C, 0x00A8, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0030, 0x00A8, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0030, 0x0174, 0x0000, 0x00C0, 0x0120, 0x02F4,
+0x0150, 0x02F4, 0x02E8, 0x02F4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0048, 0x00B4, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0174, 0x0120, 0x015C, 0x0168, 0x0174,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x01A4,
+0x0000, 0x021C, 0x05E8, 0x05F4, 0x0000, 0x0180, 0x0180, 0x0564, 0x0540, 0x0540, 0x05E8, 0x05F4,
+0x0540, 0x05A0, 0x05A0, 0x05F4, 0x05D0, 0x05F4, 0x05E8, 0x05F4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0030, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0084,
+0x0060, 0x015C, 0x0168, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x009C, 0x00A8, 0x1AF4, 0x0000, 0x0000, 0x0000, 0x19A4,
+0x0000, 0x1A40, 0x1A88, 0x20F4, 0x1A40, 0x20A0, 0x20A0, 0x23F4, 0x23D0, 0x53F4, 0x53E8, 0x53F4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1800, 0x1854, 0x0000, 0x1800, 0x1800, 0x1E24,
+0x1E00, 0x1E30, 0x21A8, 0x51B4, 0x1800, 0x1E00, 0x1E00, 0x510C, 0x2100, 0x5100, 0x5130, 0x5274,
+0x5100, 0x51C0, 0x5220, 0x5FF4, 0x53D0, 0x5FF4, 0x5FE8, 0x5FF4, 0x5100, 0x5100, 0x5100, 0x528C,
+0x5100, 0x5E80, 0x5E80, 0x5ED4, 0x5E80, 0x5E80, 0x5E80, 0x5FC4, 0x5FA0, 0x5FDC, 0x5FE8, 0x5FF4,
+0x5E80, 0x5F40, 0x5F40, 0x5F64, 0x5F40, 0x5FD0, 0x5FE8, 0x5FF4, 0x5FA0, 0x5FA0, 0x5FA0, 0x5FF4,
+0x5FD0, 0x5FF4, 0x5FE8, 0x5FF4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x1800, 0x1830, 0x18B4, 0x0000, 0x0000, 0x0000, 0x1800,
+0x1800, 0x1800, 0x1800, 0x1854, 0x1800, 0x1800, 0x1800, 0x4884, 0x4800, 0x495C, 0x4968, 0x4974,
+0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x4800, 0x4800, 0x4854, 0x4800, 0x4800, 0x4800, 0x4824,
+0x4800, 0x5490, 0x54A8, 0x54B4, 0x4800, 0x5400, 0x5400, 0x540C, 0x5400, 0x54C0, 0x5670, 0x56F4,
+0x54C0, 0x56A0, 0x56A0, 0x56F4, 0x56D0, 0x56F4, 0x56E8, 0x59F4, 0x4800, 0x4800, 0x4800, 0x5400,
+0x5400, 0x5400, 0x5400, 0x5424, 0x5400, 0x5400, 0x5400, 0x5424, 0x5400, 0x5400, 0x54A8, 0x54B4,
+0x5400, 0x5400, 0x5400, 0x540C, 0x5400, 0x5400, 0x5400, 0x5874, 0x5400, 0x57C0, 0x5820, 0x5874,
+0x5820, 0x5FF4, 0x5FE8, 0x5FF4, 0x5400, 0x5400, 0x5400, 0x570C, 0x5700, 0x5700, 0x5E80, 0x5ED4,
+0x5700, 0x5E80, 0x5E80, 0x5F04, 0x5EE0, 0x5FDC, 0x5FE8, 0x5FF4, 0x5E80, 0x5F40, 0x5F40, 0x5F64,
+0x5F40, 0x5FD0, 0x5FE8, 0x5FF4, 0x5FA0, 0x5FA0, 0x5FA0, 0x5FF4, 0x5FD0, 0x5FF4, 0x5FE8, 0x5FF4,
+0x5400, 0x5400, 0x5400, 0x5400, 0x5400, 0x5400, 0x5400, 0x5424, 0x5400, 0x5400, 0x5400, 0x5A24,
+0x5A00, 0x5A00, 0x5A48, 0x5AB4, 0x5400, 0x5A00, 0x5A00, 0x5A0C, 0x5A00, 0x5A00, 0x5A00, 0x5A54,
+0x5A00, 0x5A00, 0x5A00, 0x5B74, 0x5B20, 0x5B5C, 0x5B68, 0x5FF4, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
+0x5A00, 0x5A00, 0x5A00, 0x5A54, 0x5A00, 0x5A00, 0x5A00, 0x5F04, 0x5E80, 0x5F1C, 0x5FE8, 0x5FF4,
+0x5A00, 0x5E80, 0x5E80, 0x5F64, 0x5F40, 0x5F40, 0x5FE8, 0x5FF4, 0x5F40, 0x5FA0, 0x5FA0, 0x5FF4,
+0x5FD0, 0x5FF4, 0x5FE8, 0x5FF4, 0x5A00, 0x5A00, 0x5A00, 0x5D00, 0x5D00, 0x5D00, 0x5D00, 0x5D54,
+0x5D00, 0x5D00, 0x5D00, 0x5D24, 0x5D00, 0x5D9C, 0x5DA8, 0x5FF4, 0x5D00, 0x5D00, 0x5D00, 0x5D24,
+0x5D00, 0x5F40, 0x5F88, 0x5FF4, 0x5F40, 0x5FA0, 0x5FA0, 0x5FF4, 0x5FD0, 0x5FF4, 0x5FE8, 0x5FF4,
+0x5D00, 0x5E80, 0x5E80, 0x5E8C, 0x5E80, 0x5E80, 0x5E80, 0x5F94, 0x5E80, 0x5E80, 0x5FA0, 0x5FF4,
+0x5FA0, 0x5FF4, 0x5FE8, 0x5FF4, 0x5F40, 0x5F40, 0x5F40, 0x5F64, 0x5F40, 0x5FDC, 0x5FE8, 0x5FF4,
+0x5FA0, 0x5FA0, 0x5FD0, 0x5FF4, 0x5FD0, 0x5FF4, 0xBFF4, 0xBFF4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0090, 0x00A8, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0048, 0x00B4, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0174, 0x0120, 0x015C, 0x0168, 0x02F4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x0030, 0x00B4, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0084, 0x0060, 0x015C, 0x0168, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x009C, 0x00A8, 0x02F4,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0240, 0x0288, 0x02F4, 0x0240, 0x02A0, 0x02A0, 0x05F4,
+0x02D0, 0x05F4, 0x05E8, 0x05F4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0084, 0x0000, 0x009C, 0x0168, 0x0174,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0090, 0x00A8, 0x00B4, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x00F0, 0x02F4,
+0x0000, 0x02A0, 0x02A0, 0x02F4, 0x02D0, 0x02F4, 0x02E8, 0x02F4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x00A8, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0114, 0x0000, 0x0000, 0x0120, 0x0474,
+0x0120, 0x0474, 0x05E8, 0x05F4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0300, 0x04D4,
+0x0300, 0x0480, 0x0480, 0x0504, 0x04E0, 0x05DC, 0x0BE8, 0x0BF4, 0x0480, 0x0480, 0x0540, 0x0B64,
+0x0B40, 0x0B70, 0x0BE8, 0x0BF4, 0x0BA0, 0x0BA0, 0x0BA0, 0x0BF4, 0x0BD0, 0x0BF4, 0x0BE8, 0x0BF4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x009C, 0x00A8, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0030, 0x00A8, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0030, 0x0174, 0x0000, 0x00C0, 0x0120, 0x02F4,
+0x02D0, 0x02F4, 0x02E8, 0x02F4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0048, 0x00B4, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0174, 0x0120, 0x015C, 0x0168, 0x02F4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0504,
+0x0180, 0x051C, 0x05E8, 0x05F4, 0x0000, 0x0480, 0x0480, 0x0564, 0x0540, 0x0540, 0x05E8, 0x05F4,
+0x0540, 0x05A0, 0x05A0, 0x05F4, 0x05D0, 0x05F4, 0x05E8, 0x0BF4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0030, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0084,
+0x0060, 0x015C, 0x0168, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x009C, 0x0828, 0x08F4, 0x0000, 0x0000, 0x0000, 0x07A4,
+0x0780, 0x0840, 0x0888, 0x17F4, 0x0840, 0x08A0, 0x17A0, 0x17F4, 0x17D0, 0x17F4, 0x17E8, 0x17F4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0600, 0x0600, 0x0654, 0x0600, 0x0600, 0x0600, 0x0924,
+0x0600, 0x1530, 0x15A8, 0x15B4, 0x0600, 0x1500, 0x1500, 0x150C, 0x1500, 0x1500, 0x15F0, 0x17F4,
+0x1500, 0x15C0, 0x17A0, 0x17F4, 0x17D0, 0x17F4, 0x17E8, 0x17F4, 0x1500, 0x1500, 0x1500, 0x168C,
+0x1680, 0x1680, 0x1680, 0x16D4, 0x1680, 0x1680, 0x1680, 0x17F4, 0x17A0, 0x17DC, 0x17E8, 0x17F4,
+0x1680, 0x1740, 0x1740, 0x1764, 0x1740, 0x17DC, 0x17E8, 0x17F4, 0x17A0, 0x17A0, 0x17D0, 0x17F4,
+0x17D0, 0x17F4, 0x17E8, 0x17F4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x009C, 0x00A8, 0x0174,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0000, 0x00A8, 0x00B4, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0174,
+0x0000, 0x00C0, 0x0120, 0x0174, 0x0120, 0x02F4, 0x02E8, 0x02F4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0048, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0144,
+0x0120, 0x015C, 0x0168, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x021C, 0x0228, 0x05F4, 0x0000, 0x0000, 0x0180, 0x0564,
+0x0240, 0x0540, 0x05E8, 0x05F4, 0x0540, 0x05A0, 0x05A0, 0x05F4, 0x05D0, 0x05F4, 0x05E8, 0x05F4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x0030, 0x00B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0084, 0x0060, 0x015C, 0x0168, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x009C, 0x00A8, 0x02F4,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0240, 0x0288, 0x02F4, 0x0240, 0x02A0, 0x02A0, 0x08F4,
+0x02D0, 0x0BF4, 0x0BE8, 0x0BF4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0030, 0x06A8, 0x09B4, 0x0000, 0x0000, 0x0000, 0x090C,
+0x0600, 0x0900, 0x0930, 0x0A74, 0x0900, 0x09C0, 0x0A20, 0x0BF4, 0x0BD0, 0x0BF4, 0x0BE8, 0x23F4,
+0x0900, 0x0900, 0x0900, 0x090C, 0x0900, 0x0A80, 0x0A80, 0x22D4, 0x0A80, 0x0A80, 0x2280, 0x23C4,
+0x22E0, 0x23DC, 0x2FE8, 0x2FF4, 0x2280, 0x2340, 0x2340, 0x2F64, 0x2F40, 0x2FD0, 0x2FE8, 0x8FF4,
+0x2FA0, 0x8FA0, 0x8FA0, 0x8FF4, 0x8FD0, 0x8FF4, 0x8FE8, 0x8FF4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0030, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0084,
+0x0000, 0x009C, 0x0168, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0090, 0x00A8, 0x18B4, 0x0000, 0x0000, 0x0000, 0x180C,
+0x0000, 0x1800, 0x18F0, 0x26F4, 0x18C0, 0x1AA0, 0x26A0, 0x26F4, 0x26D0, 0x86F4, 0x86E8, 0x86F4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1800, 0x1824, 0x0000, 0x1800, 0x1800, 0x1824,
+0x1800, 0x2400, 0x24A8, 0x84B4, 0x1800, 0x2400, 0x2400, 0x240C, 0x2400, 0x8400, 0x8400, 0x8514,
+0x8400, 0x8400, 0x8520, 0x8874, 0x8820, 0x89F4, 0x89E8, 0x8FF4, 0x2400, 0x8400, 0x8400, 0x8700,
+0x8400, 0x8700, 0x8700, 0x88D4, 0x8700, 0x8880, 0x8880, 0x8F04, 0x8EE0, 0x8FDC, 0x8FE8, 0x8FF4,
+0x8880, 0x8E80, 0x8F40, 0x8F64, 0x8F40, 0x8F70, 0x8FE8, 0x8FF4, 0x8FA0, 0x8FA0, 0x8FA0, 0xBFF4,
+0xBFD0, 0xBFF4, 0xBFE8, 0xBFF4, 0x1800, 0x2400, 0x2400, 0x8400, 0x8400, 0x8400, 0x8400, 0x8424,
+0x8400, 0x8400, 0x8400, 0x8424, 0x8400, 0x8400, 0x8A48, 0x8AB4, 0x8400, 0x8400, 0x8400, 0x8A0C,
+0x8A00, 0x8A00, 0x8A00, 0x8A54, 0x8A00, 0x8A00, 0x8A00, 0x8B74, 0x8B20, 0x8B5C, 0x8B68, 0xBCF4,
+0x8A00, 0x8A00, 0x8A00, 0x8A00, 0x8A00, 0x8A00, 0x8A00, 0x8A54, 0x8A00, 0x8A00, 0x8A00, 0xBC04,
+0xBB80, 0xBF1C, 0xBFE8, 0xBFF4, 0xBA00, 0xBB80, 0xBE80, 0xBF64, 0xBF40, 0xBF40, 0xBFE8, 0xBFF4,
+0xBF40, 0xBFA0, 0xBFA0, 0xBFF4, 0xBFD0, 0xBFF4, 0xBFE8, 0xBFF4, 0x8A00, 0x8A00, 0xBA00, 0xBD00,
+0xBA00, 0xBD00, 0xBD00, 0xBD54, 0xBD00, 0xBD00, 0xBD00, 0xBD24, 0xBD00, 0xBD9C, 0xBDA8, 0xBFF4,
+0xBD00, 0xBD00, 0xBD00, 0xBD24, 0xBD00, 0xBF40, 0xBF88, 0xBFF4, 0xBF40, 0xBFA0, 0xBFA0, 0xBFF4,
+0xBFD0, 0xBFF4, 0xBFE8, 0xBFF4, 0xBD00, 0xBE80, 0xBE80, 0xBE8C, 0xBE80, 0xBE80, 0xBE80, 0xBF94,
+0xBE80, 0xBE80, 0xBFA0, 0xBFF4, 0xBFA0, 0xBFF4, 0xBFE8, 0xBFF4, 0xBF40, 0xBF40, 0xBF40, 0xBF64,
+0xBF40, 0xBFDC, 0xBFE8, 0xBFF4, 0xBFA0, 0xBFA0, 0xBFD0, 0xBFF4, 0xBFD0, 0xBFF4, 0xBFE8, 0xBFF4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x009C, 0x00A8, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x00A8, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0000, 0x0114, 0x0000, 0x0000, 0x0120, 0x0174,
+0x0120, 0x02F4, 0x02E8, 0x02F4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0030, 0x00B4, 0x0000, 0x0000, 0x0000, 0x000C,
+0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0144, 0x0060, 0x015C, 0x0168, 0x0174,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0024,
+0x0000, 0x021C, 0x6228, 0x62F4, 0x0000, 0x0000, 0x0000, 0x6264, 0x6180, 0x6240, 0x6588, 0x65F4,
+0x6240, 0x65A0, 0x65A0, 0x65F4, 0x65D0, 0x65F4, 0x65E8, 0x65F4, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x000C, 0x0000, 0x0000, 0x0030, 0x00B4,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6000, 0x6054, 0x0000, 0x6000, 0x6000, 0x6084,
+0x6000, 0x615C, 0x6168, 0x6174, 0x0000, 0x6000, 0x6000, 0x6000, 0x6000, 0x6000, 0x6000, 0x6054,
+0x6000, 0x6000, 0x6000, 0x6024, 0x6000, 0x6090, 0x60A8, 0x60B4, 0x6000, 0x6000, 0x6000, 0x6024,
+0x6000, 0x6240, 0x6288, 0x62F4, 0x6240, 0x62A0, 0x62A0, 0x62F4, 0x62D0, 0x92F4, 0x92E8, 0x95F4,
+0x6000, 0x6000, 0x6000, 0x6000, 0x6000, 0x6000, 0x6000, 0x6054, 0x6000, 0x6000, 0x6000, 0x6024,
+0x6000, 0x6030, 0x60A8, 0x90B4, 0x6000, 0x6000, 0x6000, 0x900C, 0x6000, 0x9000, 0x9330, 0x9A74,
+0x9000, 0x93C0, 0x9A20, 0x9BF4, 0x9A50, 0x9BF4, 0x9BE8, 0x9BF4, 0x9000, 0x9000, 0x9300, 0x990C,
+0x9900, 0x9A80, 0x9A80, 0x9AD4, 0x9A80, 0x9A80, 0x9A80, 0x9B04, 0x9AE0, 0x9BDC, 0x9BE8, 0x9BF4,
+0x9A80, 0x9B40, 0x9B40, 0x9B64, 0x9B40, 0x9BD0, 0x9BE8, 0x9BF4, 0x9BA0, 0x9BA0, 0x9BA0, 0x9BF4,
+0x9BD0, 0x9BF4, 0x9BE8, 0xA7F4, 0x0000, 0x6000, 0x6000, 0x6000, 0x6000, 0x6000, 0x6000, 0x6024,
+0x6000, 0x6000, 0x6000, 0x600C, 0x6000, 0x6000, 0x6000, 0x6054, 0x6000, 0x6000, 0x6000, 0x6000,
+0x6000, 0x6000, 0x6000, 0x6054, 0x6000, 0x6000, 0x6000, 0x9024, 0x9000, 0x909C, 0x9168, 0x9174,
+0x6000, 0x6000, 0x6000, 0x6000, 0x6000, 0x9000, 0x9000, 0x9054, 0x9000, 0x9000, 0x9000, 0x9024,
+0x9000, 0x9030, 0x90A8, 0x90B4, 0x9000, 0x9000, 0x9000, 0x900C, 0x9000, 0x9000, 0x90F0, 0x92F4,
+0x9000, 0x9240, 0x92A0, 0x92F4, 0x92D0, 0x92F4, 0x92E8, 0x92F4, 0x9000, 0x9000, 0x9000, 0x9000,
+0x9000, 0x9000, 0x9000, 0x9024, 0x9000, 0x9000, 0x9000, 0x9024, 0x9000, 0x9000, 0x9048, 0x90B4,
+0x9000, 0x9000, 0x9000, 0x900C, 0x9000, 0x9000, 0x9000, 0x9114, 0x9000, 0x9000, 0x90C0, 0x9174,
+0x9120, 0xA074, 0xA1E8, 0xA1F4, 0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0x9300, 0xA0D4,
+0x9000, 0xA080, 0xA080, 0xA104, 0xA080, 0xA1DC, 0xA1E8, 0xA7F4, 0xA080, 0xA080, 0xA140, 0xA164,
+0xA140, 0xA770, 0xA7E8, 0xBFF4, 0xA740, 0xBFA0, 0xBFA0, 0xBFF4, 0xBFD0, 0xBFF4, 0xBFE8, 0xBFF4,
+0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0x9024, 0x9000, 0x9000, 0x9000, 0x9024,
+0x9000, 0x9C00, 0x9C48, 0x9CB4, 0x9000, 0x9C00, 0x9C00, 0x9C0C, 0x9C00, 0x9C00, 0x9C00, 0xA254,
+0x9C00, 0x9C00, 0xA200, 0xBB74, 0xA320, 0xBB5C, 0xBB68, 0xBB74, 0x9C00, 0x9C00, 0x9C00, 0xA200,
+0xA200, 0xA200, 0xBA00, 0xBA54, 0xBA00, 0xBA00, 0xBA00, 0xBA24, 0xBA00, 0xBC1C, 0xBC28, 0xBFF4,
+0xBA00, 0xBB80, 0xBB80, 0xBF64, 0xBC40, 0xBF40, 0xBFE8, 0xBFF4, 0xBF40, 0xBFA0, 0xBFA0, 0xBFF4,
+0xBFD0, 0xBFF4, 0xBFE8, 0xBFF4, 0xBA00, 0xBA00, 0xBA00, 0xBA00, 0xBA00, 0xBA00, 0xBD00, 0xBD54,
+0xBA00, 0xBD00, 0xBD00, 0xBD24, 0xBD00, 0xBD90, 0xBDA8, 0xBDB4, 0xBD00, 0xBD00, 0xBD00, 0xBD0C,
+0xBD00, 0xBDC0, 0xBF70, 0xBFF4, 0xBDC0, 0xBFA0, 0xBFA0, 0xBFF4, 0xBFD0, 0xBFF4, 0xBFE8, 0xBFF4,
+0xBD00, 0xBE80, 0xBE80, 0xBE8C, 0xBE80, 0xBE80, 0xBE80, 0xBED4, 0xBE80, 0xBE80, 0xBE80, 0xBFF4,
+0xBFA0, 0xBFF4, 0xBFE8, 0xBFF4, 0xBF40, 0xBF40, 0xBF40, 0xBF64, 0xBF40, 0xBFDC, 0xBFE8, 0xBFF4,
+0xBFA0, 0xBFA0, 0xBFD0, 0xBFF4, 0xBFD0, 0xBFF4, 0xBFE8, 0xBFF4, 0x9000, 0x9000, 0x9000, 0x9000,
+0x9000, 0x9000, 0x9000, 0x9024, 0x9000, 0x9000, 0x9000, 0x900C, 0x9000, 0x9000, 0x9000, 0x9054,
+0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0x9054, 0x9000, 0x9000, 0x9000, 0x9024,
+0x9000, 0x909C, 0x90A8, 0x9174, 0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0x9054,
+0x9000, 0x9000, 0x9000, 0x9024, 0x9000, 0x9030, 0x90A8, 0xA8B4, 0x9000, 0x9000, 0x9000, 0xA80C,
+0x9000, 0xA800, 0xA830, 0xA974, 0xA800, 0xA8C0, 0xA920, 0xAAF4, 0xAAD0, 0xAAF4, 0xAAE8, 0xAAF4,
+0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0xA800, 0xA824, 0x9000, 0xA800, 0xA800, 0xA824,
+0xA800, 0xA800, 0xA848, 0xA8B4, 0xA800, 0xA800, 0xA800, 0xA80C, 0xA800, 0xA800, 0xA800, 0xA854,
+0xA800, 0xA800, 0xA800, 0xA974, 0xA920, 0xA95C, 0xA968, 0xADF4, 0xA800, 0xA800, 0xA800, 0xA800,
+0xA800, 0xA800, 0xA800, 0xA854, 0xA800, 0xA800, 0xA800, 0xAD04, 0xAC80, 0xAD1C, 0xADE8, 0xADF4,
+0xA800, 0xAC80, 0xAC80, 0xAD64, 0xAD40, 0xAD70, 0xADE8, 0xADF4, 0xAD40, 0xADA0, 0xADA0, 0xADF4,
+0xADD0, 0xB3F4, 0xB3E8, 0xBFF4, 0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA824,
+0xA800, 0xA800, 0xA800, 0xA80C, 0xA800, 0xA800, 0xA830, 0xA8B4, 0xA800, 0xA800, 0xA800, 0xA80C,
+0xA800, 0xA800, 0xA800, 0xA854, 0xA800, 0xA800, 0xA800, 0xA944, 0xA860, 0xA95C, 0xA968, 0xA974,
+0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA854, 0xA800, 0xA800, 0xA800, 0xAE24,
+0xA800, 0xAE9C, 0xBC28, 0xBCF4, 0xA800, 0xAE00, 0xAE00, 0xBC64, 0xBB80, 0xBC40, 0xBC88, 0xBFF4,
+0xBC40, 0xBFA0, 0xBFA0, 0xBFF4, 0xBFD0, 0xBFF4, 0xBFE8, 0xBFF4, 0xA800, 0xA800, 0xA800, 0xAE00,
+0xAE00, 0xBA00, 0xBA00, 0xBA54, 0xBA00, 0xBA00, 0xBA00, 0xBD24, 0xBD00, 0xBD90, 0xBDA8, 0xBDB4,
+0xBA00, 0xBD00, 0xBD00, 0xBD0C, 0xBD00, 0xBD00, 0xBDF0, 0xBFF4, 0xBD00, 0xBFA0, 0xBFA0, 0xBFF4,
+0xBFD0, 0xBFF4, 0xBFE8, 0xBFF4, 0xBD00, 0xBD00, 0xBD00, 0xBE8C, 0xBE80, 0xBE80, 0xBE80, 0xBED4,
+0xBE80, 0xBE80, 0xBE80, 0xBFF4, 0xBFA0, 0xBFDC, 0xBFE8, 0xBFF4, 0xBE80, 0xBF40, 0xBF40, 0xBF64,
+0xBF40, 0xBFDC, 0xBFE8, 0xBFF4, 0xBFA0, 0xBFA0, 0xBFD0, 0xBFF4, 0xBFD0, 0xBFF4, 0xBFE8, 0xBFF4,
+0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA824, 0xA800, 0xA800, 0xA800, 0xA80C,
+0xA800, 0xB400, 0xB430, 0xB4B4, 0xA800, 0xB400, 0xB400, 0xB400, 0xB400, 0xB400, 0xB400, 0xB454,
+0xB400, 0xB400, 0xB400, 0xB484, 0xB460, 0xB55C, 0xB568, 0xB574, 0xB400, 0xB400, 0xB400, 0xB400,
+0xB400, 0xB400, 0xB400, 0xB454, 0xB400, 0xB400, 0xB400, 0xB424, 0xB400, 0xB49C, 0xB4A8, 0xB6F4,
+0xB400, 0xB400, 0xB400, 0xB424, 0xB400, 0xB640, 0xB688, 0xB6F4, 0xB640, 0xB6A0, 0xB6A0, 0xB6F4,
+0xB6D0, 0xBFF4, 0xBFE8, 0xBFF4, 0xB400, 0xB400, 0xB400, 0xB400, 0xB400, 0xB400, 0xB400, 0xB454,
+0xB400, 0xB400, 0xB400, 0xB424, 0xB400, 0xB430, 0xB4A8, 0xBDB4, 0xB400, 0xB400, 0xB400, 0xB40C,
+0xB400, 0xBD00, 0xBD30, 0xBE74, 0xBD00, 0xBDC0, 0xBE20, 0xBFF4, 0xBFD0, 0xBFF4, 0xBFE8, 0xBFF4,
+0xB400, 0xBD00, 0xBD00, 0xBD0C, 0xBD00, 0xBE80, 0xBE80, 0xBED4, 0xBE80, 0xBE80, 0xBE80, 0xBFC4,
+0xBEE0, 0xBFDC, 0xBFE8, 0xBFF4, 0xBE80, 0xBF40, 0xBF40, 0xBF64, 0xBF40, 0xBFD0, 0xBFE8, 0xBFF4,
+0xBFA0, 0xBFA0, 0xBFA0, 0xBFF4, 0xBFD0, 0xBFF4, 0xBFE8, 0xBFF4, 0xB400, 0xB400, 0xB400, 0xBA00,
+0xBA00, 0xBA00, 0xBA00, 0xBA24, 0xBA00, 0xBA00, 0xBA00, 0xBA24, 0xBA00, 0xBA00, 0xBA48, 0xBAB4,
+0xBA00, 0xBA00, 0xBA00, 0xBA0C, 0xBA00, 0xBA00, 0xBA00, 0xBA54, 0xBA00, 0xBA00, 0xBAC0, 0xBB74,
+0xBB20, 0xBE74, 0xBFE8, 0xBFF4, 0xBA00, 0xBA00, 0xBA00, 0xBA00, 0xBA00, 0xBA00, 0xBA00, 0xBED4,
+0xBA00, 0xBD00, 0xBE80, 0xBF04, 0xBE80, 0xBFDC, 0xBFE8, 0xBFF4, 0xBE80, 0xBE80, 0xBF40, 0xBF64,
+0xBF40, 0xBF70, 0xBFE8, 0xBFF4, 0xBF40, 0xBFA0, 0xBFA0, 0xBFF4, 0xBFD0, 0xBFF4, 0xBFE8, 0xBFF4,
+0xBA00, 0xBD00, 0xBD00, 0xBD00, 0xBD00, 0xBD00, 0xBD00, 0xBD54, 0xBD00, 0xBD00, 0xBD00, 0xBD24,
+0xBD00, 0xBD9C, 0xBF28, 0xBFF4, 0xBD00, 0xBD00, 0xBD00, 0xBEA4, 0xBE80, 0xBF40, 0xBF88, 0xBFF4,
+0xBF40, 0xBFA0, 0xBFA0, 0xBFF4, 0xBFD0, 0xBFF4, 0xBFE8, 0xBFF4, 0xBE80, 0xBE80, 0xBE80, 0xBE8C,
+0xBE80, 0xBE80, 0xBE80, 0xBFF4, 0xBE80, 0xBF40, 0xBFA0, 0xBFF4, 0xBFA0, 0xBFF4, 0xBFE8, 0xBFF4,
+0xBF40, 0xBF40, 0xBF40, 0xBFC4, 0xBF40, 0xBFDC, 0xBFE8, 0xBFF4, 0xBFA0, 0xBFA0, 0xBFE8, 0xBFF4,
+0xBFD0, 0xBFF4, 0xBFF4, 0xBFF4
+};
+
+#endif
@@ -19,6 +19,7 @@
 */
 
 #include <string.h>
+#include <stdlib.h>
 #include <stdio.h>
 #include <math.h>
 
@@ -33,6 +34,7 @@ extern "C" {
 #include "hacks.h"
 }
 #include "sid.h"
+#include "decimator.h"
 
 #ifdef EMSCRIPTEN
 #include <emscripten.h>
@@ -42,6 +44,18 @@ extern "C" {
 // output sample rate and fractional overflows are handled here:
 static double _sample_cycles;
 
+// sub-sample of the current output sample where the emulation continues after
+// Core::skipSilence() stopped within that sample
+static uint8_t _resume_sub = 0;
+
+// int16 output with headroom (see SID::isDigiMixed()): grows to the largest
+// used slice
+static int32_t* _mix_buffer = 0;
+static uint32_t _mix_buffer_len = 0;
+
+static Decimator _decimator;
+static bool _decimator_float = false;	// history contains float output
+
 static void resetDefaults(uint32_t sample_rate, uint8_t is_rsid,
 							uint8_t is_ntsc, uint8_t is_compatible) {
 	sysReset();
@@ -56,6 +70,10 @@ static void resetDefaults(uint32_t sample_rate, uint8_t is_rsid,
 	SID::resetAll(sample_rate, clock_rate, is_rsid, is_compatible);
 
 	_sample_cycles= 0;
+	_resume_sub = 0;
+
+	// the previous song's tail must not leak into the new song
+	_decimator.reset(SID::getOversampling());
 }
 
 #ifdef TEST
@@ -81,7 +99,62 @@ void Core::rsidRunTest() {
 }
 #endif
 
-void runEmulation(uint8_t is_simple_sid_mode, int16_t* synth_buffer,
+// oversampling: the sub-samples for one output sample are rendered into a
+// small interleaved buffer that is then decimated
+template <typename T>
+static void runOversampledEmulation(uint8_t is_simple_sid_mode, T* synth_buffer, uint32_t step, uint32_t right,
+					int16_t** synth_trace_bufs, uint16_t samples_per_call) {
+
+	static T sub_samples[MAX_OVERSAMPLING << 1];
+
+	uint8_t factor = SID::getOversampling();
+	bool is_float = (T)0.5 != 0;
+	if ((_decimator.getFactor() != factor) || (_decimator_float != is_float)) {
+		_decimator.reset(factor);
+		_decimator_float = is_float;
+	}
+
+	double n= SID::getCyclesPerSample();	// per sub-sample
+
+	// same as the respective variants used in runEmulation()
+	void (*clock)() = sysClockOpt;
+	void (*synth)(T*, uint32_t, int16_t**, uint32_t) = SID::synthSamplesSingleSID<T>;
+
+	if (SID::getNumberUsedChips() > 1) {
+		if (is_simple_sid_mode) {
+			synth = SID::synthSamplesMultiSID<T>;
+		} else {
+			clock = sysClock;
+			synth = SID::synthSamplesStrippedMultiSID<T>;
+		}
+	}
+
+	// the sub-samples skipped by skipSilence() were silent
+	uint8_t first_sub = _resume_sub;
+	_resume_sub = 0;
+	for (uint8_t j= 0; j<first_sub; j++) {
+		sub_samples[j << 1] = sub_samples[(j << 1) + 1] = 0;
+	}
+
+	for (int i= 0; i<samples_per_call; i++) {
+		for (uint8_t j= i ? 0 : first_sub; j<factor; j++) {
+			while(_sample_cycles < n) {
+				clock();
+				_sample_cycles++;
+			}
+			_sample_cycles -= n;	// keep overflow
+
+			// the scopes just show the last sub-sample
+			bool is_last = j == factor - 1;
+			synth(sub_samples + (j << 1), 1, is_last ? synth_trace_bufs : 0, i);
+		}
+		T* dest = synth_buffer + i * step;
+		_decimator.decimate(sub_samples, dest, dest + right);
+	}
+}
+
+template <typename T>
+static void runRegularEmulation(uint8_t is_simple_sid_mode, T* synth_buffer, uint32_t step, uint32_t right,
 					int16_t** synth_trace_bufs, uint16_t samples_per_call) {
 
 	double n= SID::getCyclesPerSample();
@@ -114,7 +187,7 @@ void runEmulation(uint8_t is_simple_sid_mode, int16_t* synth_buffer,
 			}
 			_sample_cycles -= n;	// keep overflow
 
-			SID::synthSamplesSingleSID(synth_buffer, synth_trace_bufs, i);
+			SID::synthSamplesSingleSID(synth_buffer + i * step, right, synth_trace_bufs, i);
 		}
 
 	} else {
@@ -129,7 +202,7 @@ void runEmulation(uint8_t is_simple_sid_mode, int16_t* synth_buffer,
 				}
 				_sample_cycles -= n;	// keep overflow
 
-				SID::synthSamplesMultiSID(synth_buffer, synth_trace_bufs, i);
+				SID::synthSamplesMultiSID(synth_buffer + i * step, right, synth_trace_bufs, i);
 			}
 
 		} else {
@@ -143,23 +216,99 @@ void runEmulation(uint8_t is_simple_sid_mode, int16_t* synth_buffer,
 				}
 				_sample_cycles -= n;	// keep overflow
 
-				SID::synthSamplesStrippedMultiSID(synth_buffer, synth_trace_bufs, i);
+				SID::synthSamplesStrippedMultiSID(synth_buffer + i * step, right, synth_trace_bufs, i);
 			}
 		}
 	}
 }
 
-// XXX bad API design.. the batch size is actually controlled by samples_per_call and it may
-// result in more or less than "one frame". the below 1x per frame hacks obviously will not work anymore..
-uint8_t Core::runOneFrame(uint8_t is_simple_sid_mode, uint8_t speed, int16_t* synth_buffer,
-							int16_t** synth_trace_bufs, uint16_t samples_per_call) {
+template <typename T>
+static void runEmulation(uint8_t is_simple_sid_mode, T* synth_buffer, uint32_t step, uint32_t right,
+					int16_t** synth_trace_bufs, uint16_t samples_per_call) {
 
+	uint32_t start_ts = SYS_CYCLES();
+	double start_offset = _sample_cycles + _resume_sub * SID::getCyclesPerSample();
+
+	if (SID::getOversampling() > 1) {
+		runOversampledEmulation(is_simple_sid_mode, synth_buffer, step, right, synth_trace_bufs, samples_per_call);
+	} else {
+		runRegularEmulation(is_simple_sid_mode, synth_buffer, step, right, synth_trace_bufs, samples_per_call);
+	}
+
+	// digi samples recorded during the above emulation
+	SID::mixDigiSamples(synth_buffer, step, right, synth_trace_bufs, samples_per_call, start_ts, start_offset);
+}
+
+void Core::startFrame(uint8_t speed) {
 	SID::resetGlobalStatistics();
 
 	ciaUpdateTOD(speed); // hack: TOD is rarely used so there is no point to do it more precisely
+}
+
+uint16_t Core::skipSilence(uint8_t is_simple_sid_mode, uint16_t samples) {
+	// same clocking as used in runEmulation()
+	void (*clock)() = ((SID::getNumberUsedChips() > 1) && !is_simple_sid_mode) ? sysClock : sysClockOpt;
 
-	runEmulation(is_simple_sid_mode, synth_buffer, synth_trace_bufs, samples_per_call);
+	uint8_t factor = SID::getOversampling();
+	double n= SID::getCyclesPerSample();	// per sub-sample
+
+	for (uint16_t i= 0; i<samples; i++) {
+		for (uint8_t j= 0; j<factor; j++) {
+			while(_sample_cycles < n) {
+				clock();
+				_sample_cycles++;
+			}
+			if (SID::isAudible()) {
+				// the cycles of this sub-sample have already been emulated,
+				// i.e. the regular emulation just synthesizes it
+				_resume_sub = j;
+				return i;
+			}
+			_sample_cycles -= n;	// keep overflow
+		}
+	}
+	SID::discardDigiSamples();
+	return samples;
+}
 
+void Core::runSlice(uint8_t is_simple_sid_mode, int16_t* synth_buffer,
+					int16_t** synth_trace_bufs, uint16_t samples) {
+	if (SID::isDigiMixed()) {
+		// the digis are added once the block has been rendered (see SID::mixDigi())
+		// and the combined output must then only be clipped once
+		if (samples > _mix_buffer_len) {
+			free(_mix_buffer);
+			_mix_buffer = (int32_t*)malloc(samples * 2 * sizeof(int32_t));
+			_mix_buffer_len = samples;
+		}
+		runEmulation(is_simple_sid_mode, _mix_buffer, 2, 1, synth_trace_bufs, samples);
+		SID::clipSamples(_mix_buffer, synth_buffer, samples * 2);
+	} else {
+		runEmulation(is_simple_sid_mode, synth_buffer, 2, 1, synth_trace_bufs, samples);
+	}
+}
+
+void Core::runSlice(uint8_t is_simple_sid_mode, float* synth_buffer, uint32_t step, uint32_t right,
+					int16_t** synth_trace_bufs, uint16_t samples) {
+	runEmulation(is_simple_sid_mode, synth_buffer, step, right, synth_trace_bufs, samples);
+}
+
+uint8_t Core::runOneFrame(uint8_t is_simple_sid_mode, uint8_t speed, int16_t* synth_buffer,
+							int16_t** synth_trace_bufs, uint16_t samples_per_call) {
+	startFrame(speed);
+	runSlice(is_simple_sid_mode, synth_buffer, synth_trace_bufs, samples_per_call);
+	return 0;
+}
+
+uint8_t Core::runOneFrame(uint8_t is_simple_sid_mode, uint8_t speed, float* synth_buffer, bool planar,
+							int16_t** synth_trace_bufs, uint16_t samples_per_call) {
+	startFrame(speed);
+
+	if (planar) {
+		runSlice(is_simple_sid_mode, synth_buffer, 1, samples_per_call, synth_trace_bufs, samples_per_call);
+	} else {
+		runSlice(is_simple_sid_mode, synth_buffer, 2, 1, synth_trace_bufs, samples_per_call);
+	}
 	return 0;
 }
 
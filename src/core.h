@@ -30,6 +30,30 @@ public:
 	// and return the respective audio output
 	static uint8_t runOneFrame(uint8_t is_simple_sid_mode, uint8_t speed, int16_t* synth_buffer, 
 								int16_t** synth_trace_bufs, uint16_t samples_per_call);
+
+	// same as above but with float output (-1..1 range, not clipped) which is
+	// either interleaved or planar (all left samples followed by all right samples)
+	static uint8_t runOneFrame(uint8_t is_simple_sid_mode, uint8_t speed, float* synth_buffer, bool planar,
+								int16_t** synth_trace_bufs, uint16_t samples_per_call);
+
+	// alternative to runOneFrame() which allows to render a frame in several
+	// slices of arbitrary size: startFrame() performs the once-per-frame
+	// handling and must be called before the 1st slice of each frame
+	static void startFrame(uint8_t speed);
+	static void runSlice(uint8_t is_simple_sid_mode, int16_t* synth_buffer,
+								int16_t** synth_trace_bufs, uint16_t samples);
+	// float variant: left channel of sample i in synth_buffer[i*step] and right
+	// channel in synth_buffer[i*step + right]
+	static void runSlice(uint8_t is_simple_sid_mode, float* synth_buffer, uint32_t step, uint32_t right,
+								int16_t** synth_trace_bufs, uint16_t samples);
+
+	// fast forward used while the song has not produced any sound yet (see
+	// SID::isAudible()): emulates the next "samples" of the current frame
+	// without any synthesis (the output would just be silence). Returns the
+	// number of skipped samples, i.e. less than "samples" if the song became
+	// audible, in which case the remainder of the frame must be rendered
+	// using runSlice()
+	static uint16_t skipSilence(uint8_t is_simple_sid_mode, uint16_t samples);
 	
 	static void callKernalROMReset();
 	
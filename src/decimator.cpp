@@ -0,0 +1,107 @@
+/*
+* Decimation of oversampled audio output.
+*
+* WebSid (c) 2019 Jürgen Wothke
+* version 0.93
+*
+* Terms of Use: This software is licensed under a CC BY-NC-SA
+* (http://creativecommons.org/licenses/by-nc-sa/4.0/).
+*/
+
+#include <string.h>
+#include <math.h>
+
+#include "decimator.h"
+#include "simd.h"
+
+// passband edge relative to the output Nyquist frequency: the Blackman window
+// then reaches its stopband shortly after the Nyquist frequency
+#define CUTOFF_RATIO 0.9
+
+static int32_t round32(float sample) {
+	return (int32_t)(sample < 0 ? sample - 0.5f : sample + 0.5f);
+}
+
+static int16_t clip16(float sample) {
+	int32_t s = round32(sample);
+	if (s < -32768) return -32768;
+	if (s > 32767) return 32767;
+	return (int16_t)s;
+}
+
+Decimator::Decimator() {
+	reset(1);
+}
+
+void Decimator::reset(uint8_t factor) {
+	if (factor < 1) factor = 1;
+	if (factor > MAX_OVERSAMPLING) factor = MAX_OVERSAMPLING;
+
+	_factor = factor;
+	_taps = TAPS_PER_PHASE * factor;
+	_pos = 0;
+
+	memset(_history_l, 0, sizeof(_history_l));
+	memset(_history_r, 0, sizeof(_history_r));
+
+	// windowed-sinc lowpass (frequencies are relative to the input rate)
+	const double pi = 3.1415926535897932385;
+	double fc = CUTOFF_RATIO * 0.5 / factor;
+	double center = 0.5 * (_taps - 1);
+	double sum = 0;
+
+	for (uint16_t i= 0; i<_taps; i++) {
+		double x = i - center;
+		double sinc = 2.0 * pi * fc * x;
+		sinc = (sinc == 0) ? 2.0 * fc : sin(sinc) / (pi * x);
+
+		double w = 2.0 * pi * i / (_taps - 1);
+		double window = 0.42 - 0.5 * cos(w) + 0.08 * cos(2.0 * w);	// Blackman
+
+		_coeffs[i] = (float)(sinc * window);
+		sum += _coeffs[i];
+	}
+
+	// unity gain for DC
+	for (uint16_t i= 0; i<_taps; i++) {
+		_coeffs[i] = (float)(_coeffs[i] / sum);
+	}
+}
+
+uint8_t Decimator::getFactor() {
+	return _factor;
+}
+
+template <typename T>
+void Decimator::feed(const T* in) {
+	for (uint8_t i= 0; i<_factor; i++) {
+		// note: the filter is symmetric so the order of the history is irrelevant
+		_history_l[_pos] = _history_l[_pos + _taps] = in[0];
+		_history_r[_pos] = _history_r[_pos + _taps] = in[1];
+		in += 2;
+
+		if (++_pos == _taps) _pos = 0;
+	}
+}
+
+void Decimator::decimate(const int16_t* in, int16_t* out_l, int16_t* out_r) {
+	feed(in);
+
+	// the last _taps samples now start at the oldest entry
+	*out_l = clip16(simdDotProduct(_coeffs, _history_l + _pos, _taps));
+	*out_r = clip16(simdDotProduct(_coeffs, _history_r + _pos, _taps));
+}
+
+void Decimator::decimate(const int32_t* in, int32_t* out_l, int32_t* out_r) {
+	feed(in);
+
+	*out_l = round32(simdDotProduct(_coeffs, _history_l + _pos, _taps));
+	*out_r = round32(simdDotProduct(_coeffs, _history_r + _pos, _taps));
+}
+
+void Decimator::decimate(const float* in, float* out_l, float* out_r) {
+	feed(in);
+
+	*out_l = simdDotProduct(_coeffs, _history_l + _pos, _taps);
+	*out_r = simdDotProduct(_coeffs, _history_r + _pos, _taps);
+}
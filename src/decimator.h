@@ -0,0 +1,69 @@
+/*
+* Decimation of oversampled audio output.
+*
+* When oversampling is used (see SID::setOversampling()) then the SIDs are
+* sampled N times per output sample. The higher internal sample rate
+* captures much of the high frequency content (pulse/saw edges, noise, etc)
+* that otherwise would alias into the audible range. This class then brings
+* the stream back down to the output sample rate using a windowed-sinc
+* lowpass FIR.
+*
+* Only every Nth output of the FIR is actually calculated, i.e. it is the
+* equivalent of a polyphase decimator where each of the N phases contributes
+* TAPS_PER_PHASE taps to the respective output sample.
+*
+* WebSid (c) 2019 Jürgen Wothke
+* version 0.93
+*
+* Terms of Use: This software is licensed under a CC BY-NC-SA
+* (http://creativecommons.org/licenses/by-nc-sa/4.0/).
+*/
+#ifndef WEBSID_DECIMATOR_H
+#define WEBSID_DECIMATOR_H
+
+extern "C" {
+#include "base.h"
+}
+
+#define TAPS_PER_PHASE 32
+#define MAX_TAPS (TAPS_PER_PHASE * MAX_OVERSAMPLING)
+
+class Decimator {
+public:
+	Decimator();
+
+	/**
+	* Sets up the filter for the specified decimation factor and clears
+	* the history.
+	*/
+	void reset(uint8_t factor);
+
+	uint8_t getFactor();
+
+	/**
+	* Consumes "factor" interleaved stereo input samples and produces one
+	* stereo output sample (stored to out_l and out_r).
+	*
+	* The float and int32 variants do not clip their output.
+	*/
+	void decimate(const int16_t* in, int16_t* out_l, int16_t* out_r);
+	void decimate(const int32_t* in, int32_t* out_l, int32_t* out_r);
+	void decimate(const float* in, float* out_l, float* out_r);
+
+private:
+	template <typename T>
+	void		feed(const T* in);
+
+	uint8_t		_factor;
+	uint16_t	_taps;		// used length of the FIR (multiple of 4)
+	uint16_t	_pos;		// history index of the oldest input sample
+
+	float		_coeffs[MAX_TAPS];
+
+	// the history of each channel is stored twice in succession so that the
+	// last _taps input samples are always available as one contiguous array
+	float		_history_l[MAX_TAPS << 1];
+	float		_history_r[MAX_TAPS << 1];
+};
+
+#endif
@@ -76,6 +76,16 @@ extern "C" {
 #define MASK_DIGI_UNUSED 0x80
 #define CENTER_SAMPLE 0x80
 
+// pre-filter: bit per SID register (see detectSample())
+#define REG_BIT(reg) (((uint32_t)1) << (reg))
+#define VOICE_REGS(reg) (REG_BIT(reg) | REG_BIT(reg + 7) | REG_BIT(reg + 14))
+
+	// registers that may start one of the detected sequences (FM, PWM, swallow, D418)
+#define DETECT_REGS_BASE (VOICE_REGS(2) | VOICE_REGS(4) | REG_BIT(0x18))
+	// registers that are only relevant once the respective technique has been seen
+#define DETECT_REGS_FM_SAMPLE VOICE_REGS(1)
+#define DETECT_REGS_SWALLOW_SAMPLE VOICE_REGS(3)
+
 DigiDetector::DigiDetector(SID* sid) {
 	_sid = sid;
 	_base_addr = 0;	// not available at this point
@@ -88,39 +98,59 @@ bool DigiDetector::isMahoney() {
 	return _used_digi_type == DigiMahoneyD418;
 }
 
-int8_t DigiDetector::useOverrideDigiSignal(int32_t *digi_out, int32_t *dvoice_idx) {
-	if ((_used_digi_type != DigiNone) && _digi_enabled) {
+DigiMixMode DigiDetector::getMixMode() {
+	if ((_used_digi_type == DigiNone) || !_digi_enabled) return DigiMixOff;
 
-		(*digi_out) = getSample();	// used for "scope"
+	// note: _used_digi_type can change within same song.. (see Storebror.sid)
 
-		// note: _used_digi_type can change within same song.. (see Storebror.sid)
+	switch (_used_digi_type) {
+		case DigiMahoneyD418:
+			// hack: directly output the digi to avoid distortions caused by the
+			// low sample rate.. testcase: Acid_Flashback.sid
+			return DigiMixDirect;
 
-		switch (_used_digi_type) {
-			case DigiD418:
-			case DigiMahoneyD418:
-				// D418 needs no special handling since the effect is already
-				//       achieved modulating the regular voice output
-			
-				break;
-			case DigiFM:
-				// FM sounds fine for most songs
-				break;
-			
-			case DigiPWM:
-			case DigiPWMTest:
-				// PWM creates annoying carrier signal and used voices are therefore
-				// muted - instead the final digi signal is directly fed back into the audio signal
-				*dvoice_idx=  getSource() - 1;
-				return 1;
-			default:
-				// do not show voice output based techniques in separate digi scope..
-				break;
-		}
+		case DigiPWM:
+		case DigiPWMTest:
+			// PWM creates annoying carrier signal and used voices are therefore
+			// muted - instead the final digi signal is directly fed back into the audio signal
+			return DigiMixVoice;
+
+		default:
+			// D418 needs no special handling since the effect is already
+			// achieved modulating the regular voice output, and FM sounds
+			// fine for most songs
+			return DigiMixScope;
+	}
+}
+
+const DigiSample* DigiDetector::getSideBuffer(uint16_t* count) {
+	*count = _side_count;
+	return _side_buf;
+}
+
+void DigiDetector::consumeSideBuffer(uint16_t count) {
+	if (count < 2) return;
+
+	_side_buf[0] = _side_buf[count - 1];
+
+	uint16_t remaining = _side_count - count;
+	if (remaining) memmove(&_side_buf[1], &_side_buf[count], remaining * sizeof(DigiSample));
+
+	_side_count = remaining + 1;
+}
+
+void DigiDetector::recordSideBuffer() {
+	DigiSample *s;
+	if (_side_count < DIGI_BUF_SIZE) {
+		s = &_side_buf[_side_count++];
+		s->ts = sysCycles();
 	} else {
-		(*digi_out) = 0;
+		// should never happen: just update the last sample
+		s = &_side_buf[DIGI_BUF_SIZE - 1];
 	}
-	(*dvoice_idx) = -1;
-	return 0;
+	s->sample = _current_digi_sample;
+	s->src = _current_digi_src;
+	s->volume = _sid->_volume;
 }
 
 DigiType DigiDetector::getType() {
@@ -176,6 +206,8 @@ void DigiDetector::recordSamplePWM(uint8_t sample, uint8_t voice_plus) {
 	_current_digi_sample = ((int32_t)sample * 0x101 - 0x8000);		// override regular signal 
 	_current_digi_src = voice_plus;
 	_digi_count++;
+
+	recordSideBuffer();
 }
 
 void DigiDetector::recordSampleD418(uint8_t sample) {
@@ -184,17 +216,13 @@ void DigiDetector::recordSampleD418(uint8_t sample) {
 	_current_digi_src = 0;
 	_digi_count++;
 
-	// todo: it seems plausible to presume that updates done somewhere within
-	// the interval of the current audio sample will lead to some kind
-	// of aliasing, i.e. if the signal was "correctly" sampled every cycle
-	// then the average across the sample should be different from the "last
-	// written" value (which is currently used above).
-	
-	// status: an attempt to improve audio quality by simply interpolating the
-	// value of the next rendered sample (by using the relative timing of the
-	// update with regard to the sample's duration - see _sample_cycles in
-	// core.cpp) failed spectacularly and added obvious distortions;
-	// testcase: MyLife.sid
+	// note: an earlier attempt to improve audio quality by simply interpolating
+	// the value of the next rendered sample failed spectacularly and added
+	// obvious distortions (testcase: MyLife.sid). The recorded samples are
+	// now averaged across each output sample instead (see SID::mixDigi()).
+	// This only affects the Mahoney output and the scope - regular D418
+	// digis are played by the modulated voice output.
+	recordSideBuffer();
 }
 
 uint8_t DigiDetector::assertSameSource(uint8_t voice_plus) {
@@ -317,6 +345,7 @@ uint8_t DigiDetector::handleFreqModulationDigi(uint8_t voice, uint8_t reg, uint8
 			case 0x9:	// TEST/GATE
 				if ((_freq_detect_state[voice] == FreqPrep) && isWithinFreqDetectTimeout0(voice)) {
 					_freq_detect_state[voice] = FreqSet;	// we are getting closer
+					_detect_regs |= DETECT_REGS_FM_SAMPLE;
 					
 					// hack: reset base so that regular timeouts can be used below
 					_freq_detect_ts[voice] = sysCycles() - 4;
@@ -538,6 +567,7 @@ uint8_t DigiDetector::isMahoneyDigi() {
 
 uint8_t DigiDetector::setSwallowMode(uint8_t voice, uint8_t m) {
 	_swallow_pwm[voice] = m;
+	_detect_regs |= DETECT_REGS_SWALLOW_SAMPLE;
 	_sid->setMute(voice, 1);	// avoid wheezing base signals created by regular voice output
 
 	return 1;
@@ -666,6 +696,11 @@ static void handlePsidDigi(uint16_t addr, uint8_t value) {
 	}
 }
 
+bool DigiDetector::isPsidDigiActive() {
+	return _sample_active;
+}
+
+// note: called per output sample (see SID::mixDigi())
 int32_t DigiDetector::genPsidSample(int32_t sample_in)
 {
     static int32_t sample = 0;
@@ -678,8 +713,9 @@ int32_t DigiDetector::genPsidSample(int32_t sample_in)
 
         _frac_pos += _clock_rate / _sample_period;
 
-        if (_frac_pos > (int32_t)SID::getSampleFreq()) {
-            _frac_pos %= SID::getSampleFreq();
+        int32_t output_rate = SID::getSampleFreq() / SID::getOversampling();
+        if (_frac_pos > output_rate) {
+            _frac_pos %= output_rate;
 
 			// fetch next sample-nibble
             if (_sample_order == 0) {
@@ -752,6 +788,14 @@ void DigiDetector::resetCount() {
 	_digi_count = 0;
 }
 
+uint32_t DigiDetector::getWriteCount() {
+	return _write_count;
+}
+
+uint32_t DigiDetector::getDetectCount() {
+	return _detect_count;
+}
+
 void DigiDetector::setEnabled(uint8_t value) {
 	_digi_enabled = value;
 }
@@ -771,6 +815,9 @@ void DigiDetector::reset(uint32_t clock_rate, uint8_t is_rsid, uint8_t is_compat
 	_digi_count = 0;
 	_digi_source = MASK_DIGI_UNUSED;
 
+	_detect_regs = DETECT_REGS_BASE;
+	_write_count = _detect_count = 0;
+
 	// PSID digi stuff
 	_sample_active = _sample_position = _sample_start = _sample_end = _sample_repeat_start = _frac_pos =
 		_sample_period = _sample_repeats = _sample_order = _sample_nibble = 0;
@@ -795,6 +842,12 @@ void DigiDetector::reset(uint32_t clock_rate, uint8_t is_rsid, uint8_t is_compat
 
 	_current_digi_src = 0;
 
+	_side_buf[0].ts = 0;
+	_side_buf[0].sample = _current_digi_sample;
+	_side_buf[0].src = _current_digi_src;
+	_side_buf[0].volume = 0;
+	_side_count = 1;
+
 	_used_digi_type = DigiNone;
 }
 
@@ -835,9 +888,20 @@ uint8_t DigiDetector::detectSample(uint16_t addr, uint8_t value) {
 
 	if (SID::isExtMultiSidMode()) return 0;	// optimization for multi-SID
 
+	_write_count++;
+
 	if (!_is_compatible) {
 		handlePsidDigi(addr, value);
 	} else {
+		// pre-filter: most songs never use digis and most of the written
+		// registers cannot contribute to any of the below detectors anyway
+		// (e.g. freq-lo, AD, SR or the filter).. the FM-sample and swallow-
+		// sample registers only become relevant once the respective technique
+		// has actually been seen in the current song
+		if (!(_detect_regs & REG_BIT(addr & 0x1f))) return 0;
+
+		_detect_count++;
+
 		// mask out alternative addresses of d400 SID (see 5-Channel_Digi-Tune)..
 		// use in PSID would crash playback of recorded samples
 		if (SID::getNumberUsedChips() == 1) addr &= ~(0x3e0);
@@ -38,6 +38,28 @@ typedef enum {
 	PulseConfirm2 = 4
 } PulseDetectState;
 
+// how the recorded digi samples are mixed into the output (see SID::mixDigi())
+typedef enum {
+	DigiMixOff = 0,		// not even shown in the scope
+	DigiMixScope = 1,	// already part of the regular voice output (D418, FM)
+	DigiMixVoice = 2,	// replaces the output of the muted voice (PWM)
+	DigiMixDirect = 3	// replaces the complete SID output (Mahoney)
+} DigiMixMode;
+
+/**
+* Side buffer entry: digi sample recorded at the exact system cycle of
+* the respective SID write.
+*/
+struct DigiSample {
+	uint32_t ts;
+	int16_t sample;		// signed 16-bit
+	uint8_t src;		// voice + 1 (0 for D418)
+	uint8_t volume;		// master volume at the time of the write
+};
+
+// plenty for one block (i.e. one frame) of even the most excessive digi player
+#define DIGI_BUF_SIZE 0x800
+
 
 class DigiDetector {
 protected:
@@ -53,6 +75,7 @@ protected:
 	int32_t getSample(); // get last D418 or PWM digi-sample (as signed 16-bit)
 	int8_t getSource();
 	int32_t genPsidSample(int32_t sample_in);	// legacy PSID digis
+	bool isPsidDigiActive();
 
 	bool isMahoney();
 	
@@ -62,20 +85,36 @@ protected:
 	void setEnabled(uint8_t value);
 	
 	
+	DigiMixMode getMixMode();
+
+	/**
+	* Gets the side buffer with the digi samples recorded since the last
+	* consumeSideBuffer(). Entry 0 always is the sample that was already in
+	* effect before that, i.e. "count" is at least 1.
+	*/
+	const DigiSample* getSideBuffer(uint16_t* count);
+
 	/**
-	* @param digi_out	returns the detected raw digi signal
-	* @param dvoice_idx	returns the index of the voice that is used for digi-playback (flawed impl, but relevant FM digis only use one voice)
-	* return 1 if original voice output should be overridden
+	* Removes the first "count" samples from the side buffer, i.e. the last
+	* of them then becomes the new entry 0.
 	*/
-	int8_t useOverrideDigiSignal(int32_t *digi_out, int32_t *dvoice_idx);
+	void consumeSideBuffer(uint16_t count);
 	
 	// diagnostics
 	DigiType getType();
 	const char* getTypeDesc();
 	uint16_t getRate();
+
+	/**
+	* Number of SID writes seen by detectSample() since the last reset and the
+	* number of those writes that actually passed the pre-filter.
+	*/
+	uint32_t getWriteCount();
+	uint32_t getDetectCount();
 private:
 	void recordSamplePWM(uint8_t sample, uint8_t voice_plus);
 	void recordSampleD418(uint8_t sample);
+	void recordSideBuffer();
 	uint8_t assertSameSource(uint8_t voice_plus);
 	
 	uint8_t isWithinFreqDetectTimeout0(uint8_t voice);
@@ -103,6 +142,11 @@ private:
 	uint8_t _digi_enabled;	// for manual muting	
 	int8_t _digi_source;	// lo-nibble: voice +1
 	uint16_t _digi_count;
+
+	// pre-filter: bit per register that any of the detectors may care about
+	uint32_t _detect_regs;
+	uint32_t _write_count;
+	uint32_t _detect_count;
 	
 	// redundant environment state
 	uint8_t _is_rsid;
@@ -130,6 +174,10 @@ private:
 	
 	// swallow's PWM
 	uint16_t _swallow_pwm[3];
+
+	// recorded samples (see getSideBuffer())
+	uint16_t _side_count;
+	DigiSample _side_buf[DIGI_BUF_SIZE];
 };
 
 #endif
\ No newline at end of file
@@ -122,54 +122,29 @@ void initDelays() {
 }
 */
 
-	
-// keep state in a separate struct to avoid exposure in the header file..
-struct EnvelopeState {
- 		// raw register content
-	uint8_t ad;
-	uint8_t sr;
-
-	uint8_t envphase;
-
-    uint16_t attack;	// for 255 steps
-    uint16_t decay;		// for 255 steps
-    uint16_t sustain;
-    uint16_t release;
-
-	uint8_t envelope_output;
-	
-	uint16_t current_LFSR;	// sim counter	(continuously counting / only reset by AD(S)R match)
-	uint8_t zero_lock;  
-	uint8_t exponential_counter;    
-};
-
-// this should rather be static - but "friend" wouldn't work then
-struct EnvelopeState* getState(Envelope* e) {	
-	return (struct EnvelopeState*)e->_state;
-}
 
 Envelope::Envelope(SID* sid, uint8_t voice) {
 	_sid = sid;
 	_voice = voice;
-	_state = (void*) malloc(sizeof(struct EnvelopeState));
-		
+	memset((uint8_t*)&_state, 0, sizeof(EnvelopeState));
+
 	syncADR();
 }
 
 void Envelope::syncADR() {
 	// synchronize cache with ADSR register content
 	// testcase: Bella_Ciao.sid
-	EnvelopeState* state= getState(this);
+	EnvelopeState* state= &_state;
 	state->attack  = COUNTER_PERIOD[state->ad >> 4];
 	state->decay   = COUNTER_PERIOD[state->ad & 0xf];
 	state->release = COUNTER_PERIOD[state->sr & 0xf];
 }
 
 uint8_t Envelope::getAD() {
-	return getState(this)->ad;
+	return _state.ad;
 }
 uint8_t Envelope::getSR() {
-	return getState(this)->sr;
+	return _state.sr;
 }
 
 void Envelope::poke(uint8_t reg, uint8_t val) {
@@ -178,7 +153,7 @@ void Envelope::poke(uint8_t reg, uint8_t val) {
 
 	switch (reg) {
         case 0x4: {
-			struct EnvelopeState* state= getState(this);
+			struct EnvelopeState* state= &_state;
 
 			uint8_t old_gate = _sid->getWave(_voice) & 0x1;
 			uint8_t new_gate = val & 0x01;
@@ -209,7 +184,7 @@ void Envelope::poke(uint8_t reg, uint8_t val) {
 			break;
 		}
         case 0x5: {		// set AD		
-			struct EnvelopeState* state = getState(this);
+			struct EnvelopeState* state = &_state;
 			state->ad = val;
 			
 			// convenience: threshold to be reached before incrementing volume
@@ -218,7 +193,7 @@ void Envelope::poke(uint8_t reg, uint8_t val) {
 			break;
 		}
         case 0x6: {		// set SR
-			struct EnvelopeState* state= getState(this);
+			struct EnvelopeState* state= &_state;
 			state->sr = val;
 
 			// convenience
@@ -231,12 +206,12 @@ void Envelope::poke(uint8_t reg, uint8_t val) {
 }
 
 uint8_t Envelope::getOutput() {
-	struct EnvelopeState* state = getState(this);
+	struct EnvelopeState* state = &_state;
 	return state->envelope_output;
 }
 
 void Envelope::reset() {
-	struct EnvelopeState* state = getState(this);
+	struct EnvelopeState* state = &_state;
 	memset((uint8_t*)state, 0, sizeof(EnvelopeState));
 	
 	syncADR();
@@ -265,7 +240,7 @@ uint8_t Envelope::handleExponentialDelay(struct EnvelopeState* state) {
 }
 
 void Envelope::clockEnvelope() {
-	struct EnvelopeState* state = getState(this);
+	struct EnvelopeState* state = &_state;
 			
 	if (++state->current_LFSR >= LFSR_LIMIT) {
 		state->current_LFSR = 0;
@@ -334,6 +309,144 @@ void Envelope::clockEnvelope() {
 	}
 }
 
+bool Envelope::isIdle() {
+	return (_state.envelope_output == 0) && _state.zero_lock;
+}
+
+void Envelope::fastForwardIdle(uint32_t cycles) {
+	// while zero-locked the only thing that still happens is the counting of
+	// the LFSR (which is reset whenever the threshold of the current phase
+	// is hit) - so the effect of clockEnvelope() can be calculated directly
+	struct EnvelopeState* state = &_state;
+
+	uint16_t threshold;
+	switch (state->envphase) {
+		case Attack:
+			threshold = state->attack;
+			break;
+		case Release:
+			threshold = state->release;
+			break;
+		default:	// decay & sustain
+			threshold = state->decay;
+			break;
+	}
+
+	// cycles until the threshold is hit for the 1st time (see ADSR-bug)
+	uint32_t first_hit = (state->current_LFSR < threshold) ?
+							threshold - state->current_LFSR :
+							LFSR_LIMIT - state->current_LFSR + threshold;
+
+	if (cycles < first_hit) {
+		uint32_t lfsr = state->current_LFSR + cycles;
+		state->current_LFSR = (lfsr >= LFSR_LIMIT) ? lfsr - LFSR_LIMIT : lfsr;
+	} else {
+		state->current_LFSR = (cycles - first_hit) % threshold;
+
+		if ((state->envphase == Decay) || (state->envphase == Release)) {
+			// handleExponentialDelay() always completes its "round" at level 0
+			state->exponential_counter = 0;
+		}
+	}
+}
+
+uint16_t Envelope::getThreshold() {
+	struct EnvelopeState* state = &_state;
+
+	switch (state->envphase) {
+		case Attack:
+			return state->attack;
+		case Release:
+			return state->release;
+		default:	// decay & sustain
+			return state->decay;
+	}
+}
+
+uint8_t Envelope::getHitsToNextStep() {
+	// number of LFSR threshold hits until the envelope counter changes
+	// (or the phase is switched) - 0 means never
+	struct EnvelopeState* state = &_state;
+
+	if (state->zero_lock || (state->envphase == Sustain)) return 0;
+	if (state->envphase == Attack) return 1;
+
+	// see handleExponentialDelay()
+	uint8_t delay = EXPONENTIAL_DELAYS[state->envelope_output];
+	return (state->exponential_counter + 1 >= delay) ? 1 : delay - state->exponential_counter;
+}
+
+void Envelope::advance(uint32_t cycles) {
+	// same as clockEnvelope() but instead of the individual cycles only the
+	// cycles where the LFSR hits the threshold are considered: between two
+	// "events" the threshold stays the same, i.e. the LFSR is reset every
+	// "threshold" cycles (except for the 1st hit, see ADSR-bug) and the
+	// envelope counter only changes every EXPONENTIAL_DELAYS[] hits
+	struct EnvelopeState* state = &_state;
+
+	if ((state->envphase == Sustain) && (state->envelope_output > state->sustain) && cycles) {
+		// a lowered sustain level only switches back to decay in the next cycle
+		clockEnvelope();
+		cycles--;
+	}
+
+	while (cycles) {
+		uint8_t hits = getHitsToNextStep();
+		if (!hits) {
+			// the output will no longer change within this span
+			fastForwardIdle(cycles);
+			return;
+		}
+
+		uint16_t threshold = getThreshold();
+		uint32_t first_hit = (state->current_LFSR < threshold) ?
+								threshold - state->current_LFSR :
+								LFSR_LIMIT - state->current_LFSR + threshold;
+
+		uint32_t step = first_hit + (hits - 1) * threshold;	// cycles until the output changes
+		if (cycles < step) {
+			if (cycles < first_hit) {
+				uint32_t lfsr = state->current_LFSR + cycles;
+				state->current_LFSR = (lfsr >= LFSR_LIMIT) ? lfsr - LFSR_LIMIT : lfsr;
+			} else {
+				// only some of the exponential delay's round was completed
+				state->current_LFSR = (cycles - first_hit) % threshold;
+				state->exponential_counter += 1 + (cycles - first_hit) / threshold;
+			}
+			return;
+		}
+		cycles -= step;
+
+		// same as the respective threshold hit in clockEnvelope()
+		state->current_LFSR = 0;
+		state->exponential_counter = 0;
+
+		uint8_t previous_envelope_output = state->envelope_output;
+
+		switch (state->envphase) {
+			case Attack:
+				state->envelope_output = (state->envelope_output + 1) & 0xff;
+				if (state->envelope_output == 0xff) {
+					state->envphase = Decay;
+				}
+				break;
+			case Decay:
+				if (state->envelope_output != state->sustain) {
+					state->envelope_output = (state->envelope_output - 1) & 0xff;
+				} else {
+					state->envphase = Sustain;
+				}
+				break;
+			default:	// release
+				state->envelope_output = (state->envelope_output - 1) & 0xff;
+				break;
+		}
+		if ((state->envelope_output == 0) && (previous_envelope_output > state->envelope_output)) {
+			state->zero_lock = 1;
+		}
+	}
+}
+
 /*
 Notes regarding ADSR-bug:
 
@@ -14,6 +14,31 @@ extern "C" {
 #include "base.h"
 }
 
+/**
+* Envelope generator state.
+*
+* Kept inline (see Envelope) so that it lives in the same memory block as the
+* owning SID and the rest of the per-cycle state.
+*/
+struct EnvelopeState {
+		// raw register content
+	uint8_t ad;
+	uint8_t sr;
+
+	uint8_t envphase;
+
+	uint16_t attack;	// for 255 steps
+	uint16_t decay;		// for 255 steps
+	uint16_t sustain;
+	uint16_t release;
+
+	uint8_t envelope_output;
+
+	uint16_t current_LFSR;	// sim counter	(continuously counting / only reset by AD(S)R match)
+	uint8_t zero_lock;
+	uint8_t exponential_counter;
+};
+
 /**
 * This class handles the envelope generation for one specific voice of the SID chip.
 *
@@ -22,6 +47,7 @@ extern "C" {
 class Envelope {
 protected:
 	friend class SID;
+	friend class EnvelopeTest;	// see tools/envtest
 	Envelope(class SID* sid, uint8_t voice);
 		
 	/**
@@ -30,6 +56,25 @@ protected:
 	void reset();
 
 	void clockEnvelope();	// +1 cycle
+
+	/**
+	* Checks if the output is locked at zero, i.e. clocking will not
+	* change the output until the next "attack" is started.
+	*/
+	bool isIdle();
+
+	/**
+	* Same as the respective number of clockEnvelope() calls - but only
+	* valid while isIdle().
+	*/
+	void fastForwardIdle(uint32_t cycles);
+
+	/**
+	* Same as the respective number of clockEnvelope() calls - but the cost
+	* depends on the number of envelope steps rather than on the number of
+	* cycles.
+	*/
+	void advance(uint32_t cycles);
 	
 	/**
 	* Handle those SID writes that impact the envelope generator.
@@ -51,13 +96,13 @@ protected:
 	uint8_t getSR();
 private:
 	void syncADR();
+	uint16_t getThreshold();
+	uint8_t getHitsToNextStep();
 	uint8_t triggerLFSR_Threshold(uint16_t threshold, uint16_t* end);
 	uint8_t handleExponentialDelay(struct EnvelopeState* state);
 	
 private:
-	friend struct EnvelopeState* getState(Envelope *e);
-
-	void* _state;	// don't want this header file cluttered with all the implementation details..
+	struct EnvelopeState _state;	// hot: touched every cycle
 	class SID* _sid;
 	uint8_t _voice;
 };
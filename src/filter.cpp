@@ -37,6 +37,11 @@ const double FILTERED_SCOPE_SCALEDOWN =  0.2;	// tuned using "424.sid"
 #include "sid.h"
 
 uint32_t Filter::_sample_rate;
+uint32_t Filter::_filter_rate;
+uint32_t Filter::_filter_rate_cfg = 0;
+uint8_t Filter::_substeps = 1;
+
+#define MAX_SUBSTEPS 8
 
 Filter::Filter(SID* sid) {
 	_sid = sid;
@@ -52,9 +57,20 @@ void Filter::clearFilterState() {
 	}
 }
 
+void Filter::setFilterRate(uint32_t rate) {
+	_filter_rate_cfg = rate;
+}
+
 void Filter::setSampleRate(uint32_t sample_rate) {
 	_sample_rate = sample_rate;
 
+	// the actual filter rate is a multiple of the sample rate
+	uint32_t substeps = (_filter_rate_cfg + (sample_rate >> 1)) / sample_rate;
+	_substeps = substeps < 1 ? 1 : substeps > MAX_SUBSTEPS ? MAX_SUBSTEPS : substeps;
+	_filter_rate = _sample_rate * _substeps;
+
+	updateTables();
+
 	clearFilterState();
 	resyncCache();	
 }
@@ -124,7 +140,12 @@ int32_t Filter::getVoiceOutput(int32_t voice_idx, int32_t* in) {
 	// regular routing
 	if (_filter_ena[voice_idx] && _is_filter_on) {
 		// route to filter
-		out= doGetFilterOutput(*in, &s->_bp_out, &s->_lp_out, &s->_hp_out);
+		synth_t filter_in = synthFromInt(*in);
+		synth_t filter_out = 0;
+		for (uint8_t i= 0; i<_substeps; i++) {
+			filter_out = doGetFilterOutput(filter_in, &s->_bp_out, &s->_lp_out, &s->_hp_out);
+		}
+		out= synthToInt(filter_out);
 	} else {
 		// route directly to output
 		out= *in;
@@ -138,6 +159,53 @@ int32_t Filter::getVoiceOutput(int32_t voice_idx, int32_t* in) {
 	return out;
 }
 
+void Filter::getVoiceOutputs(int32_t* in, uint8_t active, int32_t* out) {
+	uint8_t routed = 0;		// bit per voice that goes through the filter
+#ifdef USE_FILTER
+	if (_is_filter_on) {
+		for (uint8_t voice_idx= 0; voice_idx<3; voice_idx++) {
+			if (_filter_ena[voice_idx] && (active & (1 << voice_idx))) {
+				routed |= 1 << voice_idx;
+			}
+		}
+	}
+#endif
+	if (!routed) {
+		out[0] = in[0];
+		out[1] = in[1];
+		out[2] = in[2];
+		return;
+	}
+
+#ifdef USE_SYNTH_VEC
+	// the lanes of voices that are not routed to the filter are calculated
+	// as well but their results are then just ignored
+	synth_vec filter_in = { synthFromInt(in[0]), synthFromInt(in[1]), synthFromInt(in[2]), 0 };
+	synth_vec bp = { _voice[0]._bp_out, _voice[1]._bp_out, _voice[2]._bp_out, 0 };
+	synth_vec lp = { _voice[0]._lp_out, _voice[1]._lp_out, _voice[2]._lp_out, 0 };
+	synth_vec hp = { _voice[0]._hp_out, _voice[1]._hp_out, _voice[2]._hp_out, 0 };
+
+	synth_vec filter_out;
+	doGetFilterOutputs(&filter_in, &bp, &lp, &hp, &filter_out, _substeps);
+
+	for (uint8_t voice_idx= 0; voice_idx<3; voice_idx++) {
+		if (routed & (1 << voice_idx)) {
+			FilterState *s = &_voice[voice_idx];
+			s->_bp_out = bp[voice_idx];
+			s->_lp_out = lp[voice_idx];
+			s->_hp_out = hp[voice_idx];
+
+			out[voice_idx] = synthToInt(filter_out[voice_idx]);
+		} else {
+			out[voice_idx] = in[voice_idx];
+		}
+	}
+#else
+	for (uint8_t voice_idx= 0; voice_idx<3; voice_idx++) {
+		out[voice_idx] = (routed & (1 << voice_idx)) ? getVoiceOutput(voice_idx, &in[voice_idx]) : in[voice_idx];
+	}
+#endif
+}
 
 // note: in order to get a nicely centered graph, unfortunately the filter calcs
 // have to be repeated (the alternative would be to compensate SID specific offsets - which would 
@@ -152,7 +220,12 @@ int32_t Filter::getVoiceScopeOutput(int32_t voice_idx, int32_t* in) {
 	// regular routing
 	if (_filter_ena[voice_idx] && _is_filter_on) {
 		// route to filter
-		out= doGetFilterOutput(*in, &s->_bp_out, &s->_lp_out, &s->_hp_out) * FILTERED_SCOPE_SCALEDOWN;
+		synth_t filter_in = synthFromInt(*in);
+		synth_t filter_out = 0;
+		for (uint8_t i= 0; i<_substeps; i++) {
+			filter_out = doGetFilterOutput(filter_in, &s->_bp_out, &s->_lp_out, &s->_hp_out);
+		}
+		out= synthToDouble(filter_out) * FILTERED_SCOPE_SCALEDOWN;
 	} else {
 		// route directly to output
 		out= *in * SCOPE_SCALEDOWN;
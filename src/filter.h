@@ -30,11 +30,12 @@
 extern "C" {
 #include "base.h"
 }
+#include "synthtype.h"
 
 struct FilterState {
-	double _lp_out;	// previous "low pass" output
-	double _bp_out;	// previous "band pass" output
-	double _hp_out;	// previous "hi pass" output
+	synth_t _lp_out;	// previous "low pass" output
+	synth_t _bp_out;	// previous "band pass" output
+	synth_t _hp_out;	// previous "hi pass" output
 };
 
 /**
@@ -43,6 +44,24 @@ struct FilterState {
 * It is a construct exclusively used by the SID class and access is restricted accordingly.
 */
 class Filter {
+public:
+	/**
+	* Runs the filters at (approximately) the specified internal rate regardless
+	* of the used sample rate, i.e. the filter is then stepped multiple times per
+	* sample. 0 (default) means once per sample.
+	*
+	* The filter is stepped round(rate / sample rate) times per sample (at
+	* least once and at most MAX_SUBSTEPS times), i.e. the actually used rate
+	* is the multiple of the sample rate that is closest to the specified rate:
+	* e.g. 88200 is used as is at 44.1kHz and 22.05kHz but results in 96000 at
+	* 48kHz. The coefficients are calculated for that actual rate, i.e. the
+	* cutoff frequencies do not depend on the sample rate but the remaining
+	* discretization effects of the filter still differ slightly.
+	*
+	* Takes effect with the next setSampleRate().
+	*/
+	static void setFilterRate(uint32_t rate);
+
 protected:
 	Filter(class SID* sid);
 	virtual ~Filter();
@@ -51,6 +70,13 @@ protected:
 
 	int32_t getVoiceOutput(int32_t voice_idx, int32_t* in);
 	int32_t getVoiceScopeOutput(int32_t voice_idx, int32_t* in);
+
+	/**
+	* Same as getVoiceOutput() but for all 3 voices in one go.
+	*
+	* @param active bit per voice: inactive (e.g. muted) voices are not clocked
+	*/
+	void getVoiceOutputs(int32_t* in, uint8_t active, int32_t* out);
 	
 	/**
 	* Handle those SID writes that impact the filter.
@@ -63,8 +89,18 @@ protected:
 	/**
 	* Hooks that must be defined in subclasses.
 	*/
+	// (re)builds the model's sample rate specific coefficient tables
+	virtual void updateTables() = 0;
+	// updates the coefficients after register changes (should just be table lookups)
 	virtual void resyncCache() = 0;
-	virtual double doGetFilterOutput(double sum_filter_in, double* band_pass, double* low_pass, double* hi_pass) = 0;
+	virtual synth_t doGetFilterOutput(synth_t sum_filter_in, synth_t* band_pass, synth_t* low_pass, synth_t* hi_pass) = 0;
+#ifdef USE_SYNTH_VEC
+	// same as above for the 3 voices (lanes) in parallel and with "steps" iterations
+	// (vectors are passed by pointer since the by-value ABI of the 4 x double
+	// vector depends on the target's SIMD extensions)
+	virtual void doGetFilterOutputs(const synth_vec* sum_filter_in, synth_vec* band_pass, synth_vec* low_pass,
+											synth_vec* hi_pass, synth_vec* filter_out, uint8_t steps) = 0;
+#endif
 
 private:
 	friend class SID;
@@ -77,6 +113,9 @@ private:
 	
 protected:
 	static uint32_t _sample_rate;		// target playback sample rate
+	static uint32_t _filter_rate;		// rate that the coefficients are calculated for
+	static uint32_t _filter_rate_cfg;	// see setFilterRate()
+	static uint8_t _substeps;			// filter steps per sample
 
 	// register input
 	uint8_t _reg_cutoff_lo;		// filter cutoff low (3 bits)
@@ -89,7 +128,7 @@ protected:
 	bool  _hipass_ena;
 		
 	// term used in biquad (1/Q)
-	double _resonance;
+	synth_coeff_t _resonance;
 		
 private:
 		// control flags from registers	
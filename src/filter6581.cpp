@@ -81,6 +81,9 @@ double calcDistRescale(double distort_offset, double distort_scale) {
 }
 
 // XXX fixme; defaults tuned using 48kHz samplerate.. adjust to the actually used sample rate!
+// (this is only done when an explicit filter rate is used, see Filter::setFilterRate(), or
+// when the filter runs at a higher rate, e.g. 96kHz output or oversampling)
+#define TUNING_SAMPLE_RATE 48000
 
 // The below settings were hand-tuned using a MOS 6581 R4AR.
 // params are global and equally affect all SIDs configured to emulate a 6581 model
@@ -105,6 +108,10 @@ double Filter6581::_distort_threshold = 1134;	// filter-output/cutoff register "
 double Filter6581::_distort_1_div_scale = 1.0 / Filter6581::_distort_scale;
 double Filter6581::_distort_rescale = calcDistRescale(Filter6581::_distort_offset, Filter6581::_distort_scale);
 
+synth_real_t Filter6581::_dist_idx_scale;
+synth_real_t Filter6581::_dist_idx_cutoff;
+synth_real_t Filter6581::_dist_idx_base;
+
 												
 // copy of above params used to interface with JavaScript side
 double Filter6581::_shadow_config_6581[9];
@@ -115,19 +122,27 @@ bool Filter6581::_distortion_cache_ready = false;
 // "kink"-distorted "cutoff register"
 //double Filter6581::_kinked[CUTOFF_SIZE];
 
-// precalculated filter cutoffs for different levels of distortion
-double Filter6581::_distortion_tbls_by_cutoff[CUTOFF_SIZE][DIST_LEVELS];
+double Filter6581::_kink_levels[CUTOFF_SIZE];
+
+// precalculated filter cutoffs for different levels of distortion (built lazily)
+float Filter6581::_distortion_tbls_by_cutoff[CUTOFF_SIZE][DIST_LEVELS];
+bool Filter6581::_distortion_row_ready[CUTOFF_SIZE];
+double Filter6581::_cutoff_scale = 1.0;
 
 // currently selected row from the above table: precalculated
 // distortion levels for the currently selected filter cutoff
-double* Filter6581::_distortion_tbl = 0;
+float* Filter6581::_distortion_tbl = 0;
 
 // copy of cutoff information of a specific distortion level
 // used to interface with JavaScript side
 double Filter6581::_tmp_cutoff_tbl[CUTOFF_SIZE];
 
+bool Filter6581::_resonance_tbl_ready = false;
+synth_coeff_t Filter6581::_resonance_tbl[16];
+
 Filter6581::Filter6581(SID* sid) : Filter(sid) {
-	Filter6581::init();
+	// note: the (expensive) distortion tables are only built once the
+	// filter is actually put to use, see init()
 }
 
 Filter6581::~Filter6581() {
@@ -138,34 +153,55 @@ void Filter6581::init() {
 		Filter6581::setFilterConfig6581(_base, _max, _steepness, _x_offset, _distort, _distort_offset, _distort_scale, _distort_threshold, _kink);
 }
 
-void Filter6581::resyncCache() {
-#ifdef USE_FILTER
-	int reg_cutoff = _reg_cutoff_lo + _reg_cutoff_hi * 8;
-	_reg_cutoff = (double)reg_cutoff;
+void Filter6581::updateTables() {
+	// note: by default the cutoff related tables do not depend on the sample rate (see
+	// _distortion_tbls_by_cutoff) and the resonance table only needs to be built once
+	double scale = (_filter_rate_cfg || (_filter_rate > TUNING_SAMPLE_RATE)) ?
+						((double)TUNING_SAMPLE_RATE) / _filter_rate : 1.0;
+	if (scale != _cutoff_scale) {
+		_cutoff_scale = scale;
+
+		memset(_distortion_row_ready, 0, sizeof(_distortion_row_ready));
+		if (_distortion_tbl) {
+			getDistortionRow((_distortion_tbl - _distortion_tbls_by_cutoff[0]) / DIST_LEVELS);
+		}
+	}
 
-	_distortion_tbl = _distortion_tbls_by_cutoff[reg_cutoff >> 1];
+	if (_resonance_tbl_ready) return;
+	_resonance_tbl_ready = true;
 
-	// see http://www.fooplot.com/#W3sidHlwZSI6MCwiZXEiOiI4LjAveCIsImNvbG9yIjoiIzAwMDAwMCJ9LHsidHlwZSI6MCwiZXEiOiIxLygwLjcwNyt4LzE1KSIsImNvbG9yIjoiI0VCMEMwQyJ9LHsidHlwZSI6MCwiZXEiOiIxLjQxIiwiY29sb3IiOiIjMDAwMDAwIn0seyJ0eXBlIjowLCJlcSI6IjAuOS8oMStleHAoLSgoLXgqMTYuNykvNDApLTMuNCkpKzAuNTQiLCJjb2xvciI6IiMxODA2N0QifSx7InR5cGUiOjEwMDAsIndpbmRvdyI6WyIwIiwiMTUiLCIwIiwiMiJdfV0-
+	for (int res = 0; res < 16; res++) {
+		// see http://www.fooplot.com/#W3sidHlwZSI6MCwiZXEiOiI4LjAveCIsImNvbG9yIjoiIzAwMDAwMCJ9LHsidHlwZSI6MCwiZXEiOiIxLygwLjcwNyt4LzE1KSIsImNvbG9yIjoiI0VCMEMwQyJ9LHsidHlwZSI6MCwiZXEiOiIxLjQxIiwiY29sb3IiOiIjMDAwMDAwIn0seyJ0eXBlIjowLCJlcSI6IjAuOS8oMStleHAoLSgoLXgqMTYuNykvNDApLTMuNCkpKzAuNTQiLCJjb2xvciI6IiMxODA2N0QifSx7InR5cGUiOjEwMDAsIndpbmRvdyI6WyIwIiwiMTUiLCIwIiwiMiJdfV0-
 
-	// Correct resonance handling seems to be much more complex than what is done
-	// here (see respective "gain" implementation in recent resid) and this here is bound to
-	// lead to produce somewhat flawed results.
+		// Correct resonance handling seems to be much more complex than what is done
+		// here (see respective "gain" implementation in recent resid) and this here is bound to
+		// lead to produce somewhat flawed results.
 
-	// interestingly Hermit had added a fixed output in the low resonances (see back curves in above graph)
-	// making the higher range fall steeper (whatever he tried to achieve might no longer be necessary
-	// after I added distortion?). todo: find a testcase where this "feature" had any benefit:
+		// interestingly Hermit had added a fixed output in the low resonances (see back curves in above graph)
+		// making the higher range fall steeper (whatever he tried to achieve might no longer be necessary
+		// after I added distortion?). todo: find a testcase where this "feature" had any benefit:
 
 //	_resonance = ((_reg_res_flt > 0x5F) ? 8.0 / (_reg_res_flt >> 4) : 1.41);	// Hermit's
 
-	// whereas some older resid here used a continuously falling curve that covered about the
-	// same result range (see red curve):
+		// whereas some older resid here used a continuously falling curve that covered about the
+		// same result range (see red curve):
 
-	_resonance = 1.0/(0.707 + (_reg_res_flt >> 4)/0x0f);
-#endif
+		_resonance_tbl[res] = synthCoeff(1.0/(0.707 + res/0x0f));
+	}
 }
 
-double Filter6581::cutoffMultiplier(double filter_out) {
+void Filter6581::resyncCache() {
+#ifdef USE_FILTER
+	int reg_cutoff = _reg_cutoff_lo + _reg_cutoff_hi * 8;
+	_reg_cutoff = (synth_real_t)reg_cutoff;
+
+	_distortion_tbl = getDistortionRow(reg_cutoff >> 1);
+	_resonance = _resonance_tbl[_reg_res_flt >> 4];
+#endif
+}
 
+synth_coeff_t Filter6581::cutoffMultiplier(synth_t filter_out) {
+#ifdef SYNTH_DOUBLE
 	filter_out+= _distort_offset;		// sim "all" positive voltage levels, e.g. 0..160000 range (plus overflows at both ends)
 	filter_out*= _distort_1_div_scale;	//  scale to "same" 0..2047 range as cutoff register	
 
@@ -182,6 +218,16 @@ double Filter6581::cutoffMultiplier(double filter_out) {
 		i = index < DIST_LEVELS ? index : DIST_LEVELS-1;
 	}
 	return _distortion_tbl[i];
+#else
+	// same as above (see setFilterConfig6581()) - just without the use of "double"
+	synth_real_t index = synthToFloat(filter_out) * _dist_idx_scale + _reg_cutoff * _dist_idx_cutoff + _dist_idx_base;
+
+	int i= 0;
+	if (index > 0) {
+		i = index < DIST_LEVELS ? (int)index : DIST_LEVELS-1;
+	}
+	return synthCoeff(_distortion_tbl[i]);
+#endif
 }
 
 double* Filter6581::getFilterConfig6581() {
@@ -213,6 +259,11 @@ int Filter6581::setFilterConfig6581(double base, double max, double steepness, d
 	_distort_1_div_scale= 1.0 / _distort_scale;
 	_distort_rescale = calcDistRescale(distort_offset, distort_scale);
 
+	// index = (((filter_out + _distort_offset) * _distort_1_div_scale + _reg_cutoff) * 0.5 - _distort_threshold) * _distort_rescale
+	_dist_idx_scale = 0.5 * _distort_1_div_scale * _distort_rescale;
+	_dist_idx_cutoff = 0.5 * _distort_rescale;
+	_dist_idx_base = (0.5 * _distort_offset * _distort_1_div_scale - _distort_threshold) * _distort_rescale;
+
 
 	for (int cutoff_level = 0; cutoff_level < CUTOFF_SIZE; cutoff_level++) {
 
@@ -223,14 +274,14 @@ int Filter6581::setFilterConfig6581(double base, double max, double steepness, d
 			k+= ((double)(cutoff_level%m))/m*(0.05/i);
 		}
 //		_kinked[cutoff_level] = k;
+		_kink_levels[cutoff_level] = _kink*k;
+	}
 
-		for (int slice = 0; slice < DIST_LEVELS; slice++) {
-			double co= max * (max-base) /
-							(1.0 + exp(-((((cutoff_level<<1) - x_offset + (_kink*k)) + distort*slice)/steepness)))
-							+ base;
-
-			_distortion_tbls_by_cutoff[cutoff_level][slice] = co;
-		}
+	// the distortion table rows are now rebuilt on demand.. except for
+	// the row that is currently in use
+	memset(_distortion_row_ready, 0, sizeof(_distortion_row_ready));
+	if (_distortion_tbl) {
+		getDistortionRow((_distortion_tbl - _distortion_tbls_by_cutoff[0]) / DIST_LEVELS);
 	}
 	_distortion_cache_ready= true;
 
@@ -240,12 +291,39 @@ int Filter6581::setFilterConfig6581(double base, double max, double steepness, d
 	return 0;
 }
 
+double Filter6581::calcCutoff(int cutoff_level, int slice) {
+	return _max * (_max-_base) /
+			(1.0 + exp(-((((cutoff_level<<1) - _x_offset + _kink_levels[cutoff_level]) + _distort*slice)/_steepness)))
+			+ _base;
+}
+
+float* Filter6581::getDistortionRow(int cutoff_level) {
+	float* row = _distortion_tbls_by_cutoff[cutoff_level];
+
+	if (!_distortion_row_ready[cutoff_level]) {
+		for (int slice = 0; slice < DIST_LEVELS; slice++) {
+			row[slice] = calcCutoff(cutoff_level, slice) * _cutoff_scale;
+		}
+		_distortion_row_ready[cutoff_level] = true;
+	}
+	return row;
+}
+
+int Filter6581::getDistortionRowCount() {
+	int count = 0;
+	for (int cutoff_level = 0; cutoff_level < CUTOFF_SIZE; cutoff_level++) {
+		if (_distortion_row_ready[cutoff_level]) count++;
+	}
+	return count;
+}
+
 double* Filter6581::getCutoff6581(int distort_level) {
 	Filter6581::init();	// allow access before emulator has been properly initialized
 
 	if ((distort_level >= 0) && (distort_level < DIST_LEVELS)) {
+		// calculated directly, i.e. this does not force the complete table to be built
 		for (int cutoff_level = 0; cutoff_level < CUTOFF_SIZE; cutoff_level++) {
-			_tmp_cutoff_tbl[cutoff_level]= _distortion_tbls_by_cutoff[cutoff_level][distort_level];
+			_tmp_cutoff_tbl[cutoff_level]= calcCutoff(cutoff_level, distort_level);
 		}
 	}
 	return _tmp_cutoff_tbl;
@@ -253,13 +331,15 @@ double* Filter6581::getCutoff6581(int distort_level) {
 
 #define DAMPEN 0.7	// needed to avoid wild oscillations in wf_02_BP_6581.sid test song
 
-double Filter6581::doGetFilterOutput(double sum_filter_in, double* band_pass, double* low_pass, double* hi_pass) {
+static const synth_coeff_t _dampen = synthCoeff(DAMPEN);
 
-	(*hi_pass) = (sum_filter_in + (*band_pass) * _resonance + (*low_pass)) * DAMPEN;
-	(*band_pass) = (*band_pass) - (*hi_pass) * cutoffMultiplier(-(*hi_pass));
-	(*low_pass) = (*low_pass) + (*band_pass) * cutoffMultiplier(-(*band_pass));
+synth_t Filter6581::doGetFilterOutput(synth_t sum_filter_in, synth_t* band_pass, synth_t* low_pass, synth_t* hi_pass) {
 
-	double filter_out = 0;
+	(*hi_pass) = synthMul(sum_filter_in + synthMul(*band_pass, _resonance) + (*low_pass), _dampen);
+	(*band_pass) = (*band_pass) - synthMul(*hi_pass, cutoffMultiplier(-(*hi_pass)));
+	(*low_pass) = (*low_pass) + synthMul(*band_pass, cutoffMultiplier(-(*band_pass)));
+
+	synth_t filter_out = 0;
 
 	// verified with my different 6581 SIDs
 	if (_hipass_ena)	{ filter_out -= (*hi_pass); }
@@ -268,3 +348,54 @@ double Filter6581::doGetFilterOutput(double sum_filter_in, double* band_pass, do
 			
 	return filter_out;
 }
+
+#ifdef USE_SYNTH_VEC
+// same index as in cutoffMultiplier() (for one lane of cutoffMultipliers()) but
+// clamped without branches since the sign of the filter output is hard to predict
+static inline int distortionIndex(synth_t index) {
+	index = index > 0 ? index : 0;
+	index = index < (DIST_LEVELS-1) ? index : (DIST_LEVELS-1);
+	return (int)index;
+}
+
+inline void Filter6581::cutoffMultipliers(const synth_vec* filter_out, synth_vec* multipliers) {
+	// same as cutoffMultiplier(): the arithmetic is done for all lanes in one
+	// go and only the clamping and the table lookup are done per lane
+#ifdef SYNTH_DOUBLE
+	// (_distort_rescale is positive, i.e. the index is positive whenever the
+	// scalar version's filter_out is)
+	synth_vec index = ((((*filter_out) + _distort_offset) * _distort_1_div_scale + _reg_cutoff) * 0.5 - _distort_threshold) * _distort_rescale;
+#else
+	synth_vec index = (*filter_out) * _dist_idx_scale + _reg_cutoff * _dist_idx_cutoff + _dist_idx_base;
+#endif
+	synth_vec m = { _distortion_tbl[distortionIndex(index[0])],
+					_distortion_tbl[distortionIndex(index[1])],
+					_distortion_tbl[distortionIndex(index[2])], 0 };
+	(*multipliers) = m;
+}
+
+void Filter6581::doGetFilterOutputs(const synth_vec* sum_filter_in, synth_vec* band_pass, synth_vec* low_pass,
+											synth_vec* hi_pass, synth_vec* filter_out, uint8_t steps) {
+	// same as doGetFilterOutput()
+	synth_vec m;
+	for (uint8_t i= 0; i<steps; i++) {
+		(*hi_pass) = ((*sum_filter_in) + (*band_pass) * _resonance + (*low_pass)) * _dampen;
+
+		synth_vec in = -(*hi_pass);
+		cutoffMultipliers(&in, &m);
+		(*band_pass) = (*band_pass) - (*hi_pass) * m;
+
+		in = -(*band_pass);
+		cutoffMultipliers(&in, &m);
+		(*low_pass) = (*low_pass) + (*band_pass) * m;
+	}
+
+	synth_vec out = { 0, 0, 0, 0 };
+
+	if (_hipass_ena)	{ out -= (*hi_pass); }
+	if (_bandpass_ena)	{ out -= (*band_pass); }
+	if (_lowpass_ena)	{ out += (*low_pass); }
+
+	(*filter_out) = out;
+}
+#endif
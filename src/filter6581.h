@@ -36,17 +36,30 @@ public:
 	*/ 
 	static double* getCutoff6581(int distort_level);
 
+	// number of distortion table rows that have been built since the last
+	// change of the configuration (see tools/filterbench)
+	static int getDistortionRowCount();
+
 protected:
 	Filter6581(class SID* sid);
 	virtual ~Filter6581();
 
 	static void init();
 
+	virtual void updateTables();
 	virtual void resyncCache();
 
-	virtual double doGetFilterOutput(double sum_filter_in, double* band_pass, double* low_pass, double* hi_pass);
+	virtual synth_t doGetFilterOutput(synth_t sum_filter_in, synth_t* band_pass, synth_t* low_pass, synth_t* hi_pass);
+#ifdef USE_SYNTH_VEC
+	virtual void doGetFilterOutputs(const synth_vec* sum_filter_in, synth_vec* band_pass, synth_vec* low_pass,
+											synth_vec* hi_pass, synth_vec* filter_out, uint8_t steps);
+	void cutoffMultipliers(const synth_vec* filter_out, synth_vec* multipliers);
+#endif
+
+	synth_coeff_t cutoffMultiplier(synth_t filter_out);
 
-	double cutoffMultiplier(double filter_out);
+	static double calcCutoff(int cutoff_level, int slice);
+	static float* getDistortionRow(int cutoff_level);
 	
 	friend class SID;		
 private:
@@ -64,6 +77,11 @@ private:
 
 	static double _distort_1_div_scale;	// optimization based on _distort_scale
 	static double _distort_rescale;		// optimization based on _distort_scale
+
+	// same as above but folded into one "multiply-add" (see cutoffMultiplier())
+	static synth_real_t _dist_idx_scale;
+	static synth_real_t _dist_idx_cutoff;
+	static synth_real_t _dist_idx_base;
 		// kinking effect
 	static double _kink;
 
@@ -75,19 +93,32 @@ private:
 	// "kink"-distorted "cutoff register"
 	//static double _kinked[CUTOFF_SIZE];
 
-	// precalculated filter cutoffs for different levels of distortion
-	static double _distortion_tbls_by_cutoff[CUTOFF_SIZE][DIST_LEVELS];
+	// "kink" distortion level of each cutoff (scaled by _kink)
+	static double _kink_levels[CUTOFF_SIZE];
+
+	// precalculated filter cutoffs for different levels of distortion: rows
+	// are only calculated once a song actually uses the respective cutoff
+	// (float precision is more than enough here and it halves the cache footprint)
+	static float _distortion_tbls_by_cutoff[CUTOFF_SIZE][DIST_LEVELS];
+	static bool _distortion_row_ready[CUTOFF_SIZE];
+
+	// scaling of the above cutoffs to the used filter rate (see Filter::setFilterRate())
+	static double _cutoff_scale;
 
 	// currently selected row from the above table: precalculated
 	// distortion levels for the currently selected filter cutoff
-	static double* _distortion_tbl;
+	static float* _distortion_tbl;
 
 	// copy of cutoff information of a specific distortion level 
 	// used to interface with JavaScript side
 	static double _tmp_cutoff_tbl[CUTOFF_SIZE];
 	
+	// resonance for the 4-bit register setting
+	static bool _resonance_tbl_ready;
+	static synth_coeff_t _resonance_tbl[16];
+
 	// combined content of "11-bit filter cutoff" register
-	double _reg_cutoff;	
+	synth_real_t _reg_cutoff;
 };
 
 #endif
@@ -18,36 +18,53 @@
 #include <stdlib.h>
 
 
+uint32_t Filter8580::_tables_sample_rate = 0;
+synth_coeff_t Filter8580::_cutoff_tbl[2048];
+synth_coeff_t Filter8580::_resonance_tbl[16];
+
 Filter8580::Filter8580(SID* sid) : Filter(sid) {
 }
 
 Filter8580::~Filter8580() {
 }
 
-void Filter8580::resyncCache() {
-	// since this only depends on the sid regs, it is sufficient to update this after reg updates
-#ifdef USE_FILTER
-   _cutoff_ratio_8580 = ((double) -2.0) * 3.1415926535897932385 * (12500.0 / 2048) / _sample_rate;
+void Filter8580::updateTables() {
+	// all SIDs use the same sample rate, i.e. the tables can be shared
+	if (_tables_sample_rate == _filter_rate) return;
+	_tables_sample_rate = _filter_rate;
 
-	// NOTE: +1 is meant to model that even a 0 cutoff will still let through some signal..
-	_cutoff = ((double)_reg_cutoff_lo) +  _reg_cutoff_hi * 8 + 1;
+	double cutoff_ratio_8580 = ((double) -2.0) * 3.1415926535897932385 * (12500.0 / 2048) / _filter_rate;
 
-	// slightly arched curve that rises from 0 to ca 0.8 (rises progressively slower)
-	// http://www.fooplot.com/#W3sidHlwZSI6MCwiZXEiOiIxLjAtZXhwKHgqLTcuOTg5NDgzMjcwMjM3NzE0NzM4MTE1MDM5NTI4NjAzOWUtNCkiLCJjb2xvciI6IiMwMDAwMDAifSx7InR5cGUiOjEwMDAsIndpbmRvdyI6WyIxIiwiMjA0OCIsIjAiLCIxLjEiXX1d
-	_cutoff = 1.0 - exp(_cutoff * _cutoff_ratio_8580);
+	for (int reg_cutoff = 0; reg_cutoff < 2048; reg_cutoff++) {
+		// NOTE: +1 is meant to model that even a 0 cutoff will still let through some signal..
+		double cutoff = ((double)reg_cutoff) + 1;
 
-	// seems to be similar to what old resid is using but resulting in lower end-point
-	_resonance = pow(2.0, ((4.0 - (_reg_res_flt >> 4)) / 8));	// i.e. 1.41 to 0.39
+		// slightly arched curve that rises from 0 to ca 0.8 (rises progressively slower)
+		// http://www.fooplot.com/#W3sidHlwZSI6MCwiZXEiOiIxLjAtZXhwKHgqLTcuOTg5NDgzMjcwMjM3NzE0NzM4MTE1MDM5NTI4NjAzOWUtNCkiLCJjb2xvciI6IiMwMDAwMDAifSx7InR5cGUiOjEwMDAsIndpbmRvdyI6WyIxIiwiMjA0OCIsIjAiLCIxLjEiXX1d
+		_cutoff_tbl[reg_cutoff] = synthCoeff(1.0 - exp(cutoff * cutoff_ratio_8580));
+	}
+
+	for (int res = 0; res < 16; res++) {
+		// seems to be similar to what old resid is using but resulting in lower end-point
+		_resonance_tbl[res] = synthCoeff(pow(2.0, ((4.0 - res) / 8)));	// i.e. 1.41 to 0.39
+	}
+}
+
+void Filter8580::resyncCache() {
+	// since this only depends on the sid regs, it is sufficient to update this after reg updates
+#ifdef USE_FILTER
+	_cutoff = _cutoff_tbl[_reg_cutoff_lo + _reg_cutoff_hi * 8];
+	_resonance = _resonance_tbl[_reg_res_flt >> 4];
 #endif
 }
 
-double Filter8580::doGetFilterOutput(double sum_filter_in, double* band_pass, double* low_pass, double* hi_pass) {
+synth_t Filter8580::doGetFilterOutput(synth_t sum_filter_in, synth_t* band_pass, synth_t* low_pass, synth_t* hi_pass) {
 
-	(*hi_pass) = sum_filter_in + (*band_pass) * _resonance + (*low_pass);
-	(*band_pass) = (*band_pass) - (*hi_pass) * _cutoff;
-	(*low_pass) = (*low_pass) + (*band_pass) * _cutoff;
+	(*hi_pass) = sum_filter_in + synthMul(*band_pass, _resonance) + (*low_pass);
+	(*band_pass) = (*band_pass) - synthMul(*hi_pass, _cutoff);
+	(*low_pass) = (*low_pass) + synthMul(*band_pass, _cutoff);
 
-	double filter_out = 0;
+	synth_t filter_out = 0;
 
 	// note: filter impl seems to invert the data (see 2012_High-Score_Power_Ballad 
 	// where two voices playing the same notes cancelled each other out..)
@@ -59,3 +76,23 @@ double Filter8580::doGetFilterOutput(double sum_filter_in, double* band_pass, do
 	
 	return filter_out;
 }
+
+#ifdef USE_SYNTH_VEC
+void Filter8580::doGetFilterOutputs(const synth_vec* sum_filter_in, synth_vec* band_pass, synth_vec* low_pass,
+											synth_vec* hi_pass, synth_vec* filter_out, uint8_t steps) {
+	// same as doGetFilterOutput()
+	for (uint8_t i= 0; i<steps; i++) {
+		(*hi_pass) = (*sum_filter_in) + (*band_pass) * _resonance + (*low_pass);
+		(*band_pass) = (*band_pass) - (*hi_pass) * _cutoff;
+		(*low_pass) = (*low_pass) + (*band_pass) * _cutoff;
+	}
+
+	synth_vec out = { 0, 0, 0, 0 };
+
+	if (_hipass_ena)	{ out -= (*hi_pass); }
+	if (_bandpass_ena)	{ out -= (*band_pass); }
+	if (_lowpass_ena)	{ out += (*low_pass); }
+
+	(*filter_out) = out;
+}
+#endif
@@ -22,14 +22,23 @@ protected:
 	Filter8580(class SID* sid);
 	virtual ~Filter8580();
 
+	virtual void updateTables();
 	virtual void resyncCache();
 	
-	virtual double doGetFilterOutput(double sum_filter_in, double* band_pass, double* low_pass, double* hi_pass);
+	virtual synth_t doGetFilterOutput(synth_t sum_filter_in, synth_t* band_pass, synth_t* low_pass, synth_t* hi_pass);
+#ifdef USE_SYNTH_VEC
+	virtual void doGetFilterOutputs(const synth_vec* sum_filter_in, synth_vec* band_pass, synth_vec* low_pass,
+											synth_vec* hi_pass, synth_vec* filter_out, uint8_t steps);
+#endif
 
 	friend class SID;
-private:	
-	double _cutoff_ratio_8580;
-	double _cutoff;
+private:
+	// coefficients for the 11-bit cutoff and 4-bit resonance register settings
+	static uint32_t _tables_sample_rate;
+	static synth_coeff_t _cutoff_tbl[2048];
+	static synth_coeff_t _resonance_tbl[16];
+
+	synth_coeff_t _cutoff;
 };
 
 
@@ -67,6 +67,7 @@
 extern "C" {
 #include "base.h"
 #include "memory.h"
+#include "system.h"		// SYS_CYCLES()
 };
 
 
@@ -78,6 +79,8 @@ extern "C" {
 // is here only performed at the slow output sample rate.
 
 //#define FREQUENCY 1000000 // // could use the real clock frequency here.. but  a fake precision here would be overkill
+#define EXT_HIGH_PASS_W0 ((double)100)	// hi-pass: R=1kOhm, C=10uF
+
 #ifdef RPI4
 #define APPLY_EXTERNAL_FILTER_L(output) \
 	/* my RPi4 based device does NOT use an external filter so the respective */\
@@ -95,11 +98,11 @@ extern "C" {
 /*	const double cutoff_high_pass_ext = ((double)100) / _sample_rate;*/	/* hi-pass: R=1kOhm, C=10uF; i.e. w0=100	=> causes the "saw look" on pulse WFs*/\
 /*	const double cutoff_low_pass_ext = ((double)100000) / FREQUENCY;	// lo-pass: R=10kOhm, C=1000pF; i.e. w0=100000  .. no point at low sample rate */\
 \
-	double out_l = _left_lp_out - _left_hp_out;\
-	_left_hp_out += _cutoff_high_pass_ext * out_l;\
-	_left_lp_out += (output - _left_lp_out);\
+	synth_t out_l = _left_lp_out - _left_hp_out;\
+	_left_hp_out += synthMul(out_l, _cutoff_high_pass_ext);\
+	_left_lp_out += (synthFromInt(output) - _left_lp_out);\
 /*	_left_lp_out += cutoff_low_pass_ext * (output - _left_lp_out);*/\
-	output = out_l;
+	output = synthToInt(out_l);
 #define APPLY_EXTERNAL_FILTER_R(output) \
 	/* note: an earlier cycle-by-cycle loop-impl was a performance killer and seems to have been the */\
 	/* main reason why some multi-SID songs started to stutter on my old PC.. I therefore switched to */\
@@ -109,11 +112,11 @@ extern "C" {
 /*	const double cutoff_high_pass_ext = ((double)100) / _sample_rate;*/	/* hi-pass: R=1kOhm, C=10uF; i.e. w0=100	=> causes the "saw look" on pulse WFs*/\
 /*	const double cutoff_low_pass_ext = ((double)100000) / FREQUENCY;	// lo-pass: R=10kOhm, C=1000pF; i.e. w0=100000  .. no point at low sample rate */\
 \
-	double out_r = _right_lp_out - _right_hp_out;\
-	_right_hp_out += _cutoff_high_pass_ext * out_r;\
-	_right_lp_out += (output - _right_lp_out);\
+	synth_t out_r = _right_lp_out - _right_hp_out;\
+	_right_hp_out += synthMul(out_r, _cutoff_high_pass_ext);\
+	_right_lp_out += (synthFromInt(output) - _right_lp_out);\
 /*	_right_lp_out += cutoff_low_pass_ext * (output - _right_lp_out);*/\
-	output = out_r;
+	output = synthToInt(out_r);
 #endif
 
 
@@ -231,84 +234,238 @@ static uint8_t _is_audible = 0;
 
 static SID _sids[MAX_SIDS];	// allocate the maximum
 
+static uint32_t _clock_ticks = 0;			// number of SID::clockAll() calls so far
+static uint32_t _clock_ts = 0;				// SYS_CYCLES() of the last SID::clockAll() call
+static bool _segmented = false;				// see SID::setSegmentedMode()
+
+static bool _note_events_on = false;		// see SID::setNoteEvents()
+static NoteEvent _note_events[NOTE_BUF_SIZE];
+static uint32_t _note_count = 0;
+
+// max distance between the writes that are merged into one note event
+#define NOTE_MERGE_CYCLES 64		// about one raster line
+
 // globally shared by all SIDs
 static double		_cycles_per_sample;
-static uint32_t		_sample_rate;				// target playback sample rate
+static uint32_t		_sample_rate;				// internal sample rate, i.e. target playback rate * _oversampling
+static uint8_t		_oversampling = 1;			// sub-samples rendered per output sample
+static uint8_t		_oversampling_cfg = 1;		// see SID::setOversampling()
 
 
 /**
 * This class represents one specific MOS SID chip.
 */
-SID::SID() {
+SID::SID() :	_wave_generators{ {this, 0}, {this, 1}, {this, 2} },
+				_env_generators{ {this, 0}, {this, 1}, {this, 2} },
+				_filter6581(this),
+				_filter8580(this),
+				_digi(this) {
 	_addr = 0;		// e.g. 0xd400
 
-	_env_generators[0] = new Envelope(this, 0);
-	_env_generators[1] = new Envelope(this, 1);
-	_env_generators[2] = new Envelope(this, 2);
-
-	_wave_generators[0] = new WaveGenerator(this, 0);
-	_wave_generators[1] = new WaveGenerator(this, 1);
-	_wave_generators[2] = new WaveGenerator(this, 2);
-
 	_filter= NULL;
 	setFilterModel(false);	// default to 8580
-
-	_digi = new DigiDetector(this);
 }
 
 void SID::setFilterModel(bool set_6581) {
 	if (!_filter || (set_6581 != _is_6581)) {
 		_is_6581 = set_6581;
 
-		if (_filter) { delete _filter; }
-
-		_filter = _is_6581 ? (Filter*)new Filter6581(this) : (Filter*)new Filter8580(this);
+		if (_is_6581) {
+			Filter6581::init();
+			_filter = &_filter6581;
+		} else {
+			_filter = &_filter8580;
+		}
 	}
 }
 
 WaveGenerator* SID::getWaveGenerator(uint8_t voice_idx) {
-	return _wave_generators[voice_idx];
+	return &_wave_generators[voice_idx];
 }
 
 void SID::resetEngine(uint32_t sample_rate, bool set_6581, uint32_t clock_rate) {
 	// note: structs are NOT packed and contain additional padding..
 
-	_sample_rate = sample_rate;
-	_cutoff_high_pass_ext = ((double)100) / _sample_rate;
+	_sample_rate = sample_rate * _oversampling;
+	_cutoff_high_pass_ext = synthCoeff(EXT_HIGH_PASS_W0 / _sample_rate);
 
-	_cycles_per_sample = ((double)clock_rate) / sample_rate;	// corresponds to Hermit's clk_ratio
+	_cycles_per_sample = ((double)clock_rate) / _sample_rate;	// corresponds to Hermit's clk_ratio
+
+	_sleep_mask = 0;
+	_synced_ticks = _clock_ticks;
 
 	for (uint8_t i= 0; i<3; i++) {
-		_wave_generators[i]->reset(_cycles_per_sample);
+		_wave_generators[i].reset(_cycles_per_sample);
 	}
 
 	// reset envelope generator
 	for (uint8_t i= 0; i<3; i++) {
-		_env_generators[i]->reset();
+		_env_generators[i].reset();
 	}
 
+	updateClockMasks();
+
 	// reset filter
 	resetModel(set_6581);
 
 	// reset external filter
 	_left_lp_out= _left_hp_out= 0;
+	_digi_left_lp_out= _digi_left_hp_out= _digi_right_lp_out= _digi_right_hp_out= 0;
+	_digi_left_carry= _digi_right_carry= 0;
 }
 
 void SID::clockWaveGenerators() {
 	// forward oscillators one CYCLE (required to properly time HARD SYNC)
 	for (uint8_t voice_idx= 0; voice_idx<3; voice_idx++) {
-		WaveGenerator* wave_gen = _wave_generators[voice_idx];
+		WaveGenerator* wave_gen = &_wave_generators[voice_idx];
 		wave_gen->clockPhase1();
 	}
 
 	// handle oscillator HARD SYNC (quality wise it isn't worth the trouble to
 	// use this correct impl..)
 	for (uint8_t voice_idx= 0; voice_idx<3; voice_idx++) {
-		WaveGenerator* wave_gen = _wave_generators[voice_idx];
+		WaveGenerator* wave_gen = &_wave_generators[voice_idx];
 		wave_gen->clockPhase2();
 	}
 }
 
+void SID::clockSelectedVoices() {
+	// same as clock() but skipping the sleeping/deferred voices (these are
+	// neither sync-source nor -destination and they do not interact with the
+	// ones that are clocked here)
+	if (!(_osc_clock_mask | _env_clock_mask)) return;	// whole chip is idle/deferred
+
+	for (uint8_t voice_idx= 0; voice_idx<3; voice_idx++) {
+		if (_osc_clock_mask & (1 << voice_idx)) {
+			_wave_generators[voice_idx].clockPhase1();
+		}
+	}
+	for (uint8_t voice_idx= 0; voice_idx<3; voice_idx++) {
+		if (_osc_clock_mask & (1 << voice_idx)) {
+			_wave_generators[voice_idx].clockPhase2();
+		}
+		if (_env_clock_mask & (1 << voice_idx)) {
+			_env_generators[voice_idx].clockEnvelope();
+		}
+	}
+}
+
+void SID::updateClockMasks() {
+	uint8_t awake = ~_sleep_mask & 0x7;
+
+	if (_segmented) {
+		// only what depends on the exact cycle (see WaveGenerator::isDeferrable())
+		// is still clocked cycle-by-cycle
+		uint8_t cycle_bound = 0;
+		for (uint8_t voice_idx= 0; voice_idx<3; voice_idx++) {
+			if (!_wave_generators[voice_idx].isDeferrable()) {
+				cycle_bound |= 1 << voice_idx;
+			}
+		}
+		_osc_clock_mask = awake & cycle_bound;
+		_env_clock_mask = 0;
+	} else {
+		_osc_clock_mask = _env_clock_mask = awake;
+	}
+}
+
+void SID::catchUp() {
+	// advance the deferred voices over the segment that has passed since
+	// the last "event"
+	uint32_t cycles = _clock_ticks - _synced_ticks;
+	if (!cycles) return;
+
+	_synced_ticks = _clock_ticks;
+
+	for (uint8_t voice_idx= 0; voice_idx<3; voice_idx++) {
+		uint8_t mask = 1 << voice_idx;
+
+		if (!(_sleep_mask & mask)) {	// sleeping voices are handled in wakeVoice()
+			if (!(_osc_clock_mask & mask)) {
+				_wave_generators[voice_idx].fastForward(cycles, _clock_ts);
+			}
+			if (!(_env_clock_mask & mask)) {
+				_env_generators[voice_idx].advance(cycles);
+			}
+		}
+	}
+}
+
+void SID::setSegmentedMode(bool on) {
+	for (uint8_t i= 0; i<_used_sids; i++) {
+		_sids[i].catchUp();		// settle whatever was deferred so far
+	}
+
+	_segmented = on;
+
+	for (uint8_t i= 0; i<_used_sids; i++) {
+		_sids[i].updateClockMasks();
+	}
+}
+
+void SID::setBandLimitedWaveforms(bool on) {
+	WaveGenerator::setBandLimited(on);
+
+	for (uint8_t i= 0; i<MAX_SIDS; i++) {
+		for (uint8_t j= 0; j<3; j++) {
+			_sids[i]._wave_generators[j].updateOutputFunc();
+		}
+	}
+}
+
+void SID::trySleep() {
+	// a voice whose envelope is locked at 0 only contributes a constant
+	// "DC offset" to the output - regardless of the waveform - and that
+	// will not change until a register is written again
+	for (uint8_t voice_idx= 0; voice_idx<3; voice_idx++) {
+		uint8_t mask = 1 << voice_idx;
+
+		if (!(_sleep_mask & mask) && _env_generators[voice_idx].isIdle() &&
+				_wave_generators[voice_idx].isSleepable()) {
+
+			_sleep_mask |= mask;
+			_sleep_ticks[voice_idx] = _clock_ticks;
+
+			updateClockMasks();
+		}
+	}
+}
+
+void SID::wakeVoice(uint8_t voice_idx) {
+	// catch up on the cycles that have been skipped while sleeping
+	uint32_t cycles = _clock_ticks - _sleep_ticks[voice_idx];
+
+	_wave_generators[voice_idx].fastForward(cycles, _clock_ts);
+	_env_generators[voice_idx].fastForwardIdle(cycles);
+
+	_sleep_mask &= ~(1 << voice_idx);
+
+	updateClockMasks();
+}
+
+void SID::wakeUp() {
+	for (uint8_t voice_idx= 0; voice_idx<3; voice_idx++) {
+		if (_sleep_mask & (1 << voice_idx)) {
+			wakeVoice(voice_idx);
+		}
+	}
+}
+
+void SID::setFilterRate(uint32_t rate) {
+	Filter::setFilterRate(rate);
+}
+
+void SID::setOversampling(uint8_t factor) {
+	if (factor < 1) factor = 1;
+	if (factor > MAX_OVERSAMPLING) factor = MAX_OVERSAMPLING;
+
+	_oversampling_cfg = factor;
+}
+
+uint8_t SID::getOversampling() {
+	return _oversampling;
+}
+
 double SID::getCyclesPerSample() {
 	return _cycles_per_sample;
 }
@@ -390,7 +547,7 @@ void SID::reset(uint16_t addr, uint32_t sample_rate, bool set_6581, uint32_t clo
 
 	resetEngine(sample_rate, set_6581, clock_rate);
 
-	_digi->reset(clock_rate, is_rsid, is_compatible);
+	_digi.reset(clock_rate, is_rsid, is_compatible);
 
 	// turn on full volume
 	memWriteIO(getBaseAddr() + 0x18, 0xf);
@@ -408,11 +565,12 @@ uint8_t SID::peekMem(uint16_t addr) {
 
 
 uint8_t SID::readVoiceLevel(uint8_t voice_idx) {
+	catchUp();
 
-	WaveGenerator* wave_gen = _wave_generators[voice_idx];
+	WaveGenerator* wave_gen = &_wave_generators[voice_idx];
 	bool is_muted = wave_gen->isMuted() || _filter->isSilencedVoice3(voice_idx);
 
-	return is_muted ? 0 : _env_generators[voice_idx]->getOutput();
+	return is_muted ? 0 : _env_generators[voice_idx].getOutput();
 }
 
 uint8_t SID::readMem(uint16_t addr) {
@@ -420,10 +578,14 @@ uint8_t SID::readMem(uint16_t addr) {
 
 	switch (offset) {
 	case 0x1b:	// "oscillator" .. docs once again are wrong since this is WF specific!
-		return _wave_generators[2]->getOsc();
+		catchUp();
+		if (_sleep_mask & 0x4) wakeVoice(2);
+		return _wave_generators[2].getOsc();
 
 	case 0x1c:	// envelope
-		return _env_generators[2]->getOutput();
+		catchUp();
+		if (_sleep_mask & 0x4) wakeVoice(2);
+		return _env_generators[2].getOutput();
 	}
 
 	// reading of "write only" registers returns whatever has been last
@@ -437,14 +599,23 @@ uint8_t SID::readMem(uint16_t addr) {
 
 
 void SID::poke(uint8_t reg, uint8_t val) {
+	// any write may change what the voices do, i.e. the write ends the
+	// current segment (see setSegmentedMode())
+	catchUp();
+	if (_sleep_mask) wakeUp();
+
     uint8_t voice_idx = 0;
 	if (reg < 7) {}
     else if (reg <= 13) { voice_idx = 1; reg -= 7; }
     else if (reg <= 20) { voice_idx = 2; reg -= 14; }
 
+	if (_note_events_on && ((reg <= 0x1) || (reg == 0x4))) {
+		recordNoteEvent(voice_idx, reg, val);
+	}
+
 	// writes that impact the envelope generator
 	if ((reg >= 0x4) && (reg <= 0x6)) {
-		_env_generators[voice_idx]->poke(reg, val);
+		_env_generators[voice_idx].poke(reg, val);
 	}
 
 	// writes that impact the filter
@@ -463,29 +634,30 @@ void SID::poke(uint8_t reg, uint8_t val) {
 
     switch (reg) {
         case 0x0: {
-			WaveGenerator* wave_gen = _wave_generators[voice_idx];
+			WaveGenerator* wave_gen = &_wave_generators[voice_idx];
 			wave_gen->setFreqLow(val);
             break;
         }
         case 0x1: {
-			WaveGenerator* wave_gen = _wave_generators[voice_idx];
+			WaveGenerator* wave_gen = &_wave_generators[voice_idx];
 			wave_gen->setFreqHigh(val);
             break;
         }
         case 0x2: {
-			WaveGenerator* wave_gen = _wave_generators[voice_idx];
+			WaveGenerator* wave_gen = &_wave_generators[voice_idx];
 			wave_gen->setPulseWidthLow(val);
             break;
         }
         case 0x3: {
-			WaveGenerator* wave_gen = _wave_generators[voice_idx];
+			WaveGenerator* wave_gen = &_wave_generators[voice_idx];
 			wave_gen->setPulseWidthHigh(val);
             break;
         }
         case 0x4: {
-			WaveGenerator *wave_gen = _wave_generators[voice_idx];
+			WaveGenerator *wave_gen = &_wave_generators[voice_idx];
 			wave_gen->setWave(val);
 
+			if (_segmented) updateClockMasks();
 			break;
 		}
     }
@@ -493,14 +665,77 @@ void SID::poke(uint8_t reg, uint8_t val) {
     return;
 }
 
+void SID::recordNoteEvent(uint8_t voice_idx, uint8_t reg, uint8_t val) {
+	uint8_t ctrl = getWave(voice_idx);
+	uint16_t freq = getFreq(voice_idx);
+	uint8_t type;
+
+	if (reg == 0x4) {
+		if ((val ^ ctrl) & 0x1) {
+			type = (val & 0x1) ? NoteOn : NoteOff;
+		} else if ((ctrl & 0x1) && ((val ^ ctrl) & 0xf0)) {
+			type = NoteChange;
+		} else {
+			return;
+		}
+		ctrl = val;
+	} else {
+		uint16_t f = reg ? ((freq & 0xff) | (val << 8)) : ((freq & 0xff00) | val);
+		if (!(ctrl & 0x1) || (f == freq)) return;
+
+		freq = f;
+		type = NoteChange;
+	}
+
+	const uint8_t sid_idx = this - _sids;
+	const uint32_t ts = SYS_CYCLES();
+
+	if ((type == NoteChange) && _note_count) {
+		// e.g. the second half of a frequency update
+		NoteEvent *e = &_note_events[_note_count - 1];
+		if ((e->sid_idx == sid_idx) && (e->voice_idx == voice_idx) &&
+				(e->type != NoteOff) && ((ts - e->ts) <= NOTE_MERGE_CYCLES)) {
+			e->freq = freq;
+			e->ctrl = ctrl;
+			e->ad = getAD(voice_idx);
+			e->sr = getSR(voice_idx);
+			return;
+		}
+	}
+	if (_note_count == NOTE_BUF_SIZE) return;
+
+	NoteEvent *e = &_note_events[_note_count++];
+	e->ts = ts;
+	e->freq = freq;
+	e->sid_idx = sid_idx;
+	e->voice_idx = voice_idx;
+	e->type = type;
+	e->ctrl = ctrl;
+	e->ad = getAD(voice_idx);
+	e->sr = getSR(voice_idx);
+}
+
+void SID::setNoteEvents(bool on) {
+	_note_events_on = on;
+	_note_count = 0;
+}
+
+const NoteEvent* SID::getNoteEvents(uint32_t* count) {
+	*count = _note_count;
+	return _note_events;
+}
+
+void SID::clearNoteEvents() {
+	_note_count = 0;
+}
+
 #ifdef RPI4
 // extension callback used by the RaspberryPi4 version to play on an actual SID chip
 extern void recordPokeSID(uint32_t ts, uint8_t reg, uint8_t value);
-#include "system.h"
 #endif
 
 void SID::writeMem(uint16_t addr, uint8_t value) {
-	_digi->detectSample(addr, value);
+	_digi.detectSample(addr, value);
 	_bus_write = value;
 
 	// no reason anymore to NOT always write (unlike old/un-synced version)
@@ -536,10 +771,15 @@ void SID::writeMem(uint16_t addr, uint8_t value) {
 }
 
 void SID::clock() {
+	if ((_osc_clock_mask & _env_clock_mask) != 0x7) {
+		clockSelectedVoices();
+		return;
+	}
+
 	clockWaveGenerators();		// for all 3 voices
 
 	for (uint8_t voice_idx= 0; voice_idx<3; voice_idx++) {
-		_env_generators[voice_idx]->clockEnvelope();
+		_env_generators[voice_idx].clockEnvelope();
 	}
 }
 
@@ -554,6 +794,47 @@ const int32_t _clip_value = 32767;
 	} \
 	*(dest)= (int16_t)final_sample
 
+// float output uses the -1..1 range and it is not clipped here (the multi-SID
+// sums and digis may well exceed that range)
+#define FLOAT_SCALEDOWN (1.0f / 32768)
+
+// final stage of the synthesis chain: stores a sample in the output format
+static inline void renderSample(int16_t* dest, int32_t final_sample) {
+	RENDER_CLIPPED(dest, final_sample);
+}
+
+static inline void renderSample(float* dest, int32_t final_sample) {
+	*dest = final_sample * FLOAT_SCALEDOWN;
+}
+
+// int16 range but not clipped yet (see isDigiMixed())
+static inline void renderSample(int32_t* dest, int32_t final_sample) {
+	*dest = final_sample;
+}
+
+// adds a digi level to an already rendered sample (note: int16 output is
+// only used here when the digi was not yet mixed at the start of the block,
+// see isDigiMixed())
+static inline void mixSample(int16_t* dest, double level) {
+	int32_t final_sample = *dest + (int32_t)level;
+	RENDER_CLIPPED(dest, final_sample);
+}
+
+static inline void mixSample(float* dest, double level) {
+	*dest += (float)level * FLOAT_SCALEDOWN;
+}
+
+static inline void mixSample(int32_t* dest, double level) {
+	*dest += (int32_t)level;
+}
+
+void SID::clipSamples(const int32_t* in, int16_t* out, uint32_t len) {
+	for (uint32_t i= 0; i<len; i++) {
+		int32_t final_sample = in[i];
+		RENDER_CLIPPED(out + i, final_sample);
+	}
+}
+
 
 #define OUTPUT_SCALEDOWN ((double)1.0/90)
 
@@ -564,47 +845,50 @@ const int32_t _clip_value = 32767;
 
 void SID::synthSample(int16_t** synth_trace_bufs, uint32_t offset, int32_t *s_l, int32_t *s_r) {
 
+	int32_t vin[3];		// unfiltered outputs of the 3 voices
 	int32_t vout[3];	// outputs of the 3 voices
+	uint8_t active = 0;	// bit per voice that is not muted
 
-	// digi sample add-on
-	int32_t dvoice_idx;
-	int32_t digi_out = 0;
-	int8_t digi_override= _digi->useOverrideDigiSignal(&digi_out, &dvoice_idx);
+	// note: digi samples are mixed in separately once per block (see mixDigi())
+
+	catchUp();
+	if (_sleep_mask != 0x7) trySleep();
 
 	// create output sample based on current SID state
 	for (uint8_t voice_idx= 0; voice_idx<3; voice_idx++) {
 
-		WaveGenerator* wave_gen = _wave_generators[voice_idx];
+		WaveGenerator* wave_gen = &_wave_generators[voice_idx];
 
 		bool is_muted = wave_gen->isMuted() || _filter->isSilencedVoice3(voice_idx);
 
 		if (is_muted) {
-			if (digi_override && (dvoice_idx == voice_idx)) {
-				// hack: get rid of screeching carrier signal in PWM digi-songs by
-				// replacing the SID output with the "intended" digi signal (flaw: since
-				// regular "mute" feature is used, the respective voice can no longer be
-				// manually turned off)
-				vout[voice_idx] = digi_out;
-			} else {
-				vout[voice_idx]= 0;
-			}
+			vin[voice_idx]= 0;
 
 			// trace output (always make it 16-bit)
 			if (synth_trace_bufs) {
 				int16_t *voice_trace_buffer = synth_trace_bufs[voice_idx];
-				*(voice_trace_buffer + offset) = vout[voice_idx];	// never filter
+				*(voice_trace_buffer + offset) = 0;	// never filter
 			}
 
 		} else {
-			uint8_t env_out = _env_generators[voice_idx]->getOutput();
-			int32_t outv = ((wave_gen)->*(wave_gen->getOutput))(); // crappy C++ syntax for calling the "getOutput" method
+			uint8_t env_out;
+			int32_t outv;
+			if (_sleep_mask & (1 << voice_idx)) {
+				// envelope is locked at 0 so the waveform is irrelevant
+				env_out = outv = 0;
+				wave_gen->skipSample();
+			} else {
+				env_out = _env_generators[voice_idx].getOutput();
+				wave_gen->syncCaches();
+				outv = ((wave_gen)->*(wave_gen->getOutput))(); // crappy C++ syntax for calling the "getOutput" method
+			}
 
 			// note: the _wf_zero ofset *always* creates some wave-output that will be modulated via the
 			// envelope (even when 0-waveform is set it will cause audible clicks and distortions in
 			// the scope views)
 
-			int32_t o = _vol_scale * ( env_out * (outv + _wf_zero) + _dac_offset);
-			vout[voice_idx]= _filter->getVoiceOutput(voice_idx, &o);
+			vin[voice_idx] = _vol_scale * ( env_out * (outv + _wf_zero) + _dac_offset);
+			active |= 1 << voice_idx;
 
 			// trace output (always make it 16-bit)
 			if (synth_trace_bufs) {
@@ -614,27 +898,20 @@ void SID::synthSample(int16_t** synth_trace_bufs, uint32_t offset, int32_t *s_l,
 				int16_t *voice_trace_buffer = synth_trace_bufs[voice_idx];
 
 				// the ">>8" should correctly be "/255" - but the faster but incorrect impl should be adequate here
-				o = env_out * (outv - 0x8000) >> 8;	// make sure the scope is nicely centered
+				int32_t o = env_out * (outv - 0x8000) >> 8;	// make sure the scope is nicely centered
 				*(voice_trace_buffer + offset) = (int16_t)_filter->getVoiceScopeOutput(voice_idx, &o);
 			}
 		}
 	}
+	_filter->getVoiceOutputs(vin, active, vout);
 
 
-	if (synth_trace_bufs && (dvoice_idx == -1)) {
-		// only the d418 based digis should be shown in the respective "digi track" scope
-		int16_t *voice_trace_buffer = synth_trace_bufs[3];	// d418 digi scope buffer
-		*(voice_trace_buffer + offset) = digi_out;			// save the trouble of filtering
-	}
-
 	int32_t final_sample_l;
 	int32_t final_sample_r;
 
-	if(_digi->isMahoney()) {
-		// hack: directly output the digi to avoid distortions caused by the low sample rate..
-		// testcase: Acid_Flashback.sid
-
-		final_sample_l = final_sample_r = digi_out;
+	if(_digi.isMahoney()) {
+		// the digi replaces the regular output (see mixDigi())
+		final_sample_l = final_sample_r = 0;
 	} else {
 		final_sample_l = vout[0]*_pan_left[0] + vout[1]*_pan_left[1] + vout[2]*_pan_left[2];
 		APPLY_MASTERVOLUME(final_sample_l);
@@ -645,9 +922,6 @@ void SID::synthSample(int16_t** synth_trace_bufs, uint32_t offset, int32_t *s_l,
 	APPLY_EXTERNAL_FILTER_L(final_sample_l);
 	APPLY_EXTERNAL_FILTER_R(final_sample_r);
 
-	final_sample_l = _digi->genPsidSample(final_sample_l);		// recorded PSID digis are merged in directly
-	final_sample_r = _digi->genPsidSample(final_sample_r);		// recorded PSID digis are merged in directly
-
 	*s_l = final_sample_l;
 	*s_r = final_sample_r;
 }
@@ -656,16 +930,27 @@ void SID::synthSample(int16_t** synth_trace_bufs, uint32_t offset, int32_t *s_l,
 // PCs are more widely in use, then this optimization may be ditched..
 
 void SID::synthSampleStripped(int16_t** synth_trace_bufs, uint32_t offset, int32_t *s_l, int32_t *s_r) {
+	int32_t vin[3];
 	int32_t vout[3];
 
+	catchUp();
+	if (_sleep_mask != 0x7) trySleep();
+
 	for (uint8_t voice_idx= 0; voice_idx<3; voice_idx++) {
 
-		uint8_t env_out = _env_generators[voice_idx]->getOutput();
-		WaveGenerator *wave_gen= _wave_generators[voice_idx];
-		int32_t outv = ((wave_gen)->*(wave_gen->getOutput))(); // crappy C++ syntax for calling the "getOutput" method
+		uint8_t env_out;
+		WaveGenerator *wave_gen= &_wave_generators[voice_idx];
+		int32_t outv;
+		if (_sleep_mask & (1 << voice_idx)) {
+			env_out = outv = 0;
+			wave_gen->skipSample();
+		} else {
+			env_out = _env_generators[voice_idx].getOutput();
+			wave_gen->syncCaches();
+			outv = ((wave_gen)->*(wave_gen->getOutput))(); // crappy C++ syntax for calling the "getOutput" method
+		}
 
-		int32_t o = _vol_scale * ( env_out * (outv + _wf_zero) + _dac_offset);
-		vout[voice_idx]= _filter->getVoiceOutput(voice_idx, &o);
+		vin[voice_idx] = _vol_scale * ( env_out * (outv + _wf_zero) + _dac_offset);
 
 		// trace output (always make it 16-bit)
 		if (synth_trace_bufs) {
@@ -680,6 +965,7 @@ void SID::synthSampleStripped(int16_t** synth_trace_bufs, uint32_t offset, int32
 			*(voice_trace_buffer + offset) = env_out * (outv - 0x8000) >> 8;	// make sure the scope is nicely centered
 		}
 	}
+	_filter->getVoiceOutputs(vin, 0x7, vout);
 
 	int32_t final_sample_l = vout[0]*_pan_left[0] + vout[1]*_pan_left[1] + vout[2]*_pan_left[2];
 	APPLY_MASTERVOLUME(final_sample_l);
@@ -696,23 +982,23 @@ void SID::synthSampleStripped(int16_t** synth_trace_bufs, uint32_t offset, int32
 
 // "friends only" accessors
 uint8_t SID::getWave(uint8_t voice_idx) {
-	return _wave_generators[voice_idx]->getWave();
+	return _wave_generators[voice_idx].getWave();
 }
 
 uint16_t SID::getFreq(uint8_t voice_idx) {
-	return _wave_generators[voice_idx]->getFreq();
+	return _wave_generators[voice_idx].getFreq();
 }
 
 uint16_t SID::getPulse(uint8_t voice_idx) {
-	return _wave_generators[voice_idx]->getPulse();
+	return _wave_generators[voice_idx].getPulse();
 }
 
 uint8_t SID::getAD(uint8_t voice_idx) {
-	return _env_generators[voice_idx]->getAD();
+	return _env_generators[voice_idx].getAD();
 }
 
 uint8_t SID::getSR(uint8_t voice_idx) {
-	return _env_generators[voice_idx]->getSR();
+	return _env_generators[voice_idx].getSR();
 }
 
 uint32_t SID::getSampleFreq() {
@@ -720,30 +1006,30 @@ uint32_t SID::getSampleFreq() {
 }
 
 DigiType  SID::getDigiType() {
-	return _digi->getType();
+	return _digi.getType();
 }
 
 const char*  SID::getDigiTypeDesc() {
-	return _digi->getTypeDesc();
+	return _digi.getTypeDesc();
 }
 
 uint16_t  SID::getDigiRate() {
-	return _digi->getRate();
+	return _digi.getRate();
 }
 
 void SID::setMute(uint8_t voice_idx, uint8_t is_muted) {
 	if (voice_idx > 3) voice_idx = 3; 	// no more than 4 voices per SID (volume as 4th "voice")
 
 	if (voice_idx == 3) {
-		_digi->setEnabled(!is_muted);
+		_digi.setEnabled(!is_muted);
 
 	} else {
-		_wave_generators[voice_idx]->setMute(is_muted);
+		_wave_generators[voice_idx].setMute(is_muted);
 	}
 }
 
 void SID::resetStatistics() {
-	_digi->resetCount();
+	_digi.resetCount();
 }
 
 /**
@@ -770,18 +1056,36 @@ uint16_t SID::getGlobalDigiRate() {
 	return _sids[0].getDigiRate();
 }
 
+uint32_t SID::getGlobalDigiWriteCount() {
+	uint32_t count = 0;
+	for (uint8_t i= 0; i<_used_sids; i++) {
+		count += _sids[i]._digi.getWriteCount();
+	}
+	return count;
+}
+
+uint32_t SID::getGlobalDigiDetectCount() {
+	uint32_t count = 0;
+	for (uint8_t i= 0; i<_used_sids; i++) {
+		count += _sids[i]._digi.getDetectCount();
+	}
+	return count;
+}
+
 void SID::clockAll() {
+	_clock_ticks++;
+	_clock_ts = SYS_CYCLES();
+
 	for (uint8_t i= 0; i<_used_sids; i++) {
 		SID &sid = _sids[i];
 		sid.clock();
 	}
 }
 
-void SID::synthSamplesSingleSID(int16_t* buffer, int16_t** synth_trace_bufs, uint32_t offset) {
+template <typename T>
+void SID::synthSamplesSingleSID(T* dest, uint32_t right, int16_t** synth_trace_bufs, uint32_t offset) {
 	// most relevant: single-SID case
 
-	int16_t *dest = buffer + (offset << 1);
-
 	if (SID::isAudible()) {
 		const uint8_t i= 0;
 		SID &sid = _sids[i];
@@ -790,19 +1094,18 @@ void SID::synthSamplesSingleSID(int16_t* buffer, int16_t** synth_trace_bufs, uin
 		int32_t s_l, s_r;
 		sid.synthSample(sub_buf, offset, &s_l, &s_r);
 
-		RENDER_CLIPPED(dest, s_l);
-		RENDER_CLIPPED(dest+1, s_r);
+		renderSample(dest, s_l);
+		renderSample(dest + right, s_r);
 
 	} else {
-		dest[0]= dest[1]= 0;
+		dest[0]= dest[right]= 0;
 	}
 }
 
-void SID::synthSamplesMultiSID(int16_t* buffer, int16_t** synth_trace_bufs, uint32_t offset) {
+template <typename T>
+void SID::synthSamplesMultiSID(T* dest, uint32_t right, int16_t** synth_trace_bufs, uint32_t offset) {
 	// regular multi-SID
 
-	int16_t *dest = buffer + (offset << 1);
-
 	if (SID::isAudible()) {		// might be skipped in this scenario
 		int32_t final_sample_l = 0;
 		int32_t final_sample_r = 0;
@@ -818,19 +1121,18 @@ void SID::synthSamplesMultiSID(int16_t* buffer, int16_t** synth_trace_bufs, uint
 			final_sample_r += s_r;
 		}
 
-		RENDER_CLIPPED(dest, final_sample_l);
-		RENDER_CLIPPED(dest+1, final_sample_r);
+		renderSample(dest, final_sample_l);
+		renderSample(dest + right, final_sample_r);
 
 	} else {
-		dest[0]= dest[1]= 0;
+		dest[0]= dest[right]= 0;
 	}
 }
 
-void SID::synthSamplesStrippedMultiSID(int16_t* buffer, int16_t** synth_trace_bufs, uint32_t offset) {
+template <typename T>
+void SID::synthSamplesStrippedMultiSID(T* dest, uint32_t right, int16_t** synth_trace_bufs, uint32_t offset) {
 	// reduced multi-SID case
 
-	int16_t *dest = buffer + (offset << 1);
-
 	if (SID::isAudible()) {		// might be skipped in this scenario
 		int32_t final_sample_l = 0;
 		int32_t final_sample_r = 0;
@@ -846,14 +1148,223 @@ void SID::synthSamplesStrippedMultiSID(int16_t* buffer, int16_t** synth_trace_bu
 			final_sample_r += s_r;
 		}
 
-		RENDER_CLIPPED(dest, final_sample_l);
-		RENDER_CLIPPED(dest+1, final_sample_r);
+		renderSample(dest, final_sample_l);
+		renderSample(dest + right, final_sample_r);
 
 	} else {
-		dest[0]= dest[1]= 0;
+		dest[0]= dest[right]= 0;
 	}
 }
 
+template void SID::synthSamplesSingleSID(int16_t*, uint32_t, int16_t**, uint32_t);
+template void SID::synthSamplesSingleSID(int32_t*, uint32_t, int16_t**, uint32_t);
+template void SID::synthSamplesSingleSID(float*, uint32_t, int16_t**, uint32_t);
+template void SID::synthSamplesMultiSID(int16_t*, uint32_t, int16_t**, uint32_t);
+template void SID::synthSamplesMultiSID(int32_t*, uint32_t, int16_t**, uint32_t);
+template void SID::synthSamplesMultiSID(float*, uint32_t, int16_t**, uint32_t);
+template void SID::synthSamplesStrippedMultiSID(int16_t*, uint32_t, int16_t**, uint32_t);
+template void SID::synthSamplesStrippedMultiSID(int32_t*, uint32_t, int16_t**, uint32_t);
+template void SID::synthSamplesStrippedMultiSID(float*, uint32_t, int16_t**, uint32_t);
+
+// ------------------------------------------------------------------------------
+// Digi samples recorded by the DigiDetector are mixed in once per block: Since
+// the digi signal is a step function (each sample is held until the next one
+// is written), the steps are integrated at the exact cycle where they occurred
+// rather than being point-sampled at the output rate. Each output sample uses
+// a triangular kernel (i.e. a box filter applied twice, which attenuates the
+// images of the steps much better than a single box) that spans the intervals
+// of the previous and of the current output sample. Since the second half of
+// that kernel is only known once the current interval is complete, the digi
+// signal is delayed by one output sample as compared to the regular output.
+// The scope just shows the average level within each interval.
+//
+// The digis are added to the output that the regular synthesis already
+// rendered for the block, i.e. int16 output must then be rendered with some
+// headroom so that it is clipped only once (see isDigiMixed()).
+// ------------------------------------------------------------------------------
+
+// adds the part of the step function with the specified level between u0 and
+// u1 (relative position within the current output interval: 0..1) to the
+// falling half (current output sample) and the rising half (next output
+// sample) of the triangular kernel
+static inline void integrateDigi(double u0, double u1, float level, double* fall, double* rise) {
+	double r = (u1 * u1 - u0 * u0) * 0.5;
+	*rise += level * r;
+	*fall += level * (u1 - u0 - r);
+}
+
+void SID::getDigiLevels(const DigiSample* s, DigiMixMode mode, float* l, float* r,
+						float* scope, uint8_t* scope_idx) {
+	*scope_idx = 3;	// digi scope buffer
+
+	switch (mode) {
+		case DigiMixOff:
+			*l = *r = *scope = 0;
+			return;
+
+		case DigiMixDirect:
+			*l = *r = *scope = s->sample;
+			return;
+
+		case DigiMixVoice:
+			if (s->src) {
+				uint8_t voice_idx = s->src - 1;
+				if (_wave_generators[voice_idx].isMuted() || _filter->isSilencedVoice3(voice_idx)) {
+					// hack: get rid of screeching carrier signal in PWM digi-songs by
+					// replacing the SID output with the "intended" digi signal (flaw: since
+					// regular "mute" feature is used, the respective voice can no longer be
+					// manually turned off)
+					float level = s->sample * s->volume * OUTPUT_SCALEDOWN;	// volume at the time of the write
+					*l = level * _pan_left[voice_idx];
+					*r = level * _pan_right[voice_idx];
+					*scope = s->sample;
+					*scope_idx = voice_idx;	// shown in the scope of the muted voice
+					return;
+				}
+			}
+			// fall through
+
+		default:
+			*l = *r = 0;
+			*scope = s->sample;
+	}
+}
+
+template <typename T>
+void SID::mixDigi(T* dest, uint32_t step, uint32_t right, int16_t** synth_trace_bufs, uint16_t samples,
+					uint32_t start_ts, double start_offset, double cycles_per_sample) {
+	uint16_t count;
+	const DigiSample* buf = _digi.getSideBuffer(&count);
+
+	DigiMixMode mode = _digi.getMixMode();
+	bool is_audible = mode >= DigiMixVoice;
+
+	if (is_audible || synth_trace_bufs) {
+		const double inv_cycles = 1.0 / cycles_per_sample;
+#ifndef RPI4
+		const double hp = EXT_HIGH_PASS_W0 / _sample_rate * _oversampling;	// at the output rate
+#endif
+
+		float l, r, scope;
+		uint8_t scope_idx;
+		getDigiLevels(&buf[0], mode, &l, &r, &scope, &scope_idx);
+
+		uint16_t next = 1;
+		double t = -start_offset;	// cycle position relative to start_ts
+
+		for (uint16_t i= 0; i<samples; i++) {
+			double start = i * cycles_per_sample - start_offset;
+			double end = (i + 1) * cycles_per_sample - start_offset;
+			double fall_l = 0, fall_r = 0, rise_l = 0, rise_r = 0, sum_scope = 0;
+
+			while (next < count) {
+				double ts = (int32_t)(buf[next].ts - start_ts);
+				if (ts >= end) break;	// belongs to a later sample
+
+				if (ts > t) {
+					double u0 = (t - start) * inv_cycles;
+					double u1 = (ts - start) * inv_cycles;
+					integrateDigi(u0, u1, l, &fall_l, &rise_l);
+					integrateDigi(u0, u1, r, &fall_r, &rise_r);
+					sum_scope += (ts - t) * scope;
+					t = ts;
+				}
+				getDigiLevels(&buf[next++], mode, &l, &r, &scope, &scope_idx);
+			}
+			double u0 = (t - start) * inv_cycles;
+			integrateDigi(u0, 1.0, l, &fall_l, &rise_l);
+			integrateDigi(u0, 1.0, r, &fall_r, &rise_r);
+			sum_scope += (end - t) * scope;
+			t = end;
+
+			if (synth_trace_bufs) {
+				synth_trace_bufs[3][i] = 0;
+				synth_trace_bufs[scope_idx][i] = (int16_t)(sum_scope * inv_cycles);
+			}
+
+			double out_l = _digi_left_carry + fall_l;
+			double out_r = _digi_right_carry + fall_r;
+			_digi_left_carry = rise_l;
+			_digi_right_carry = rise_r;
+
+			if (is_audible) {
+#ifndef RPI4
+				// same external filter as for the regular output (see APPLY_EXTERNAL_FILTER_L)
+				double o = _digi_left_lp_out - _digi_left_hp_out;
+				_digi_left_hp_out += hp * o;
+				_digi_left_lp_out = out_l;
+				out_l = o;
+
+				o = _digi_right_lp_out - _digi_right_hp_out;
+				_digi_right_hp_out += hp * o;
+				_digi_right_lp_out = out_r;
+				out_r = o;
+#endif
+				mixSample(dest + i * step, out_l);
+				mixSample(dest + i * step + right, out_r);
+			}
+		}
+		_digi.consumeSideBuffer(next);
+
+	} else {
+		_digi.consumeSideBuffer(count);
+		_digi_left_carry = _digi_right_carry = 0;
+	}
+
+	if (_digi.isPsidDigiActive()) {
+		// recorded PSID digis are merged in directly
+		for (uint16_t i= 0; i<samples; i++) {
+			mixSample(dest + i * step, _digi.genPsidSample(0));
+			mixSample(dest + i * step + right, _digi.genPsidSample(0));
+		}
+	}
+}
+
+template <typename T>
+void SID::mixDigiSamples(T* synth_buffer, uint32_t step, uint32_t right, int16_t** synth_trace_bufs,
+							uint16_t samples, uint32_t start_ts, double start_offset) {
+
+	if (isExtMultiSidMode()) return;	// digis are not detected in this mode
+
+	double cycles_per_sample = _cycles_per_sample * _oversampling;	// per output sample
+
+	for (uint8_t i= 0; i<_used_sids; i++) {
+		SID &sid = _sids[i];
+		int16_t **sub_buf = !synth_trace_bufs ? 0 : &synth_trace_bufs[i << 2];	// each sid uses 4 entries..
+
+		if (SID::isAudible()) {
+			sid.mixDigi(synth_buffer, step, right, sub_buf, samples, start_ts, start_offset, cycles_per_sample);
+		} else {
+			uint16_t count;
+			sid._digi.getSideBuffer(&count);
+			sid._digi.consumeSideBuffer(count);
+		}
+	}
+}
+
+template void SID::mixDigiSamples(int16_t*, uint32_t, uint32_t, int16_t**, uint16_t, uint32_t, double);
+template void SID::mixDigiSamples(int32_t*, uint32_t, uint32_t, int16_t**, uint16_t, uint32_t, double);
+template void SID::mixDigiSamples(float*, uint32_t, uint32_t, int16_t**, uint16_t, uint32_t, double);
+
+bool SID::isDigiMixed() {
+	if (isExtMultiSidMode()) return false;	// digis are not detected in this mode
+
+	for (uint8_t i= 0; i<_used_sids; i++) {
+		DigiDetector &digi = _sids[i]._digi;
+		if ((digi.getMixMode() >= DigiMixVoice) || digi.isPsidDigiActive()) return true;
+	}
+	return false;
+}
+
+void SID::discardDigiSamples() {
+	for (uint8_t i= 0; i<_used_sids; i++) {
+		SID &sid = _sids[i];
+
+		uint16_t count;
+		sid._digi.getSideBuffer(&count);
+		sid._digi.consumeSideBuffer(count);
+	}
+}
 
 void SID::resetGlobalStatistics() {
 	for (uint8_t i= 0; i<_used_sids; i++) {
@@ -895,6 +1406,12 @@ void SID::resetAll(uint32_t sample_rate, uint32_t clock_rate, uint8_t is_rsid,
 	memset(_mem2sid, 0, MEM_MAP_SIZE); // default is SID #0
 
 	_is_audible = 0;
+	_note_count = 0;
+
+	_oversampling = _oversampling_cfg;
+	while ((_oversampling > 1) && (sample_rate * _oversampling > MAX_INTERNAL_SAMPLE_RATE)) {
+		_oversampling--;	// e.g. at 192kHz there is little left to gain
+	}
 
 //	if (_ext_multi_sid) {
 //		_vol_scale = _vol_map[_sid_2nd_chan_idx ? _used_sids >> 1 : _used_sids - 1] / 0xff;
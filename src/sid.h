@@ -14,6 +14,36 @@ extern "C" {
 #include "base.h"
 }
 
+#include "wavegenerator.h"
+#include "envelope.h"
+#include "filter6581.h"
+#include "filter8580.h"
+#include "digi.h"
+
+// kinds of recorded note events (see SID::setNoteEvents())
+typedef enum {
+	NoteOn = 1,			// gate bit set
+	NoteOff = 2,		// gate bit cleared
+	NoteChange = 3		// frequency or waveform changed while the gate is on
+} NoteEventType;
+
+/**
+* Note event recorded at the exact system cycle of the respective SID write.
+*/
+struct NoteEvent {
+	uint32_t ts;		// SYS_CYCLES() of the write
+	uint16_t freq;		// oscillator frequency register
+	uint8_t sid_idx;
+	uint8_t voice_idx;
+	uint8_t type;		// see NoteEventType
+	uint8_t ctrl;		// control register: waveform (bits 4-7) and gate (bit 0)
+	uint8_t ad;			// attack/decay register
+	uint8_t sr;			// sustain/release register
+};
+
+// plenty for one block of even the most hectic arpeggio player
+#define NOTE_BUF_SIZE 0x400
+
 /**
 * Struct used to configure the number/types of used SID chips.
 *
@@ -42,19 +72,18 @@ private:
 };
 
 
-class Envelope;
-class DigiDetector;
-class WaveGenerator;
-class Filter;
-
-
 /**
 * This class emulates the "MOS Technology SID" chips (see 6581, 8580 or 6582).
 *
 * Some aspects of the implementation are delegated to separate helpers,
 * see digi.h, envelope.h, filter.h
+*
+* Memory layout: the helpers are embedded directly (rather than being allocated
+* separately) so that all the state of one SID lives in one contiguous, cache
+* line aligned block. The state that is used on every clock cycle comes first,
+* followed by the per-sample state and finally the rarely used configuration.
 */
-class SID {
+class alignas(CACHELINE_SIZE) SID {
 public:
 	SID();
 	
@@ -132,6 +161,8 @@ public:
 	
 	/**
 	* Measures the length if one sample in system cycles.
+	*
+	* note: when oversampling is used this is the length of one sub-sample
 	*/
 	static double getCyclesPerSample();
 
@@ -150,6 +181,27 @@ public:
 	static void resetAll(uint32_t sample_rate, uint32_t clock_rate, uint8_t is_rsid,
 							uint8_t is_compatible);
 
+	/**
+	* Sets the number of sub-samples that are rendered per output sample
+	* (1 means no oversampling). The sub-samples must then be decimated to
+	* the output sample rate by the caller (see Decimator).
+	*
+	* Takes effect with the next resetAll().
+	*/
+	static void setOversampling(uint8_t factor);
+	static uint8_t getOversampling();
+
+	/**
+	* Runs the filters at an internal rate (e.g. 88200 or 176400) that is
+	* independent of the output sample rate. The used rate is the closest
+	* multiple of the sample rate, e.g. 88200 becomes 96000 at 48kHz (see
+	* Filter::setFilterRate()). 0 (default) means that the filter is stepped
+	* once per sample.
+	*
+	* Takes effect with the next resetAll().
+	*/
+	static void setFilterRate(uint32_t rate);
+
 	/**
 	* Sets the pannnig for all SIDs.
 	*/
@@ -164,6 +216,22 @@ public:
 	* Clock all used SID chips.
 	*/
 	static void	clockAll();
+
+	/**
+	* Switches to "event-segmented" synthesis: oscillators and envelopes are
+	* then no longer clocked cycle-by-cycle but they are advanced in bulk
+	* for the complete segment between two "events", i.e. register writes,
+	* reads of the voice 3 registers or the rendering of an output sample.
+	* The resulting output is the same - but much cheaper to produce.
+	*/
+	static void setSegmentedMode(bool on);
+
+	/**
+	* Switches the saw and pulse based waveforms (including the respective
+	* combined waveforms) to band-limited (PolyBLEP) renderers which
+	* reduce aliasing without the cost of oversampling.
+	*/
+	static void setBandLimitedWaveforms(bool on);
 		
 	/**
 	* Gets the type of digi samples used in the current song.
@@ -184,6 +252,29 @@ public:
 	* Gets rate of digi samples used in the current song.
 	*/	
 	static uint16_t getGlobalDigiRate();
+
+	/**
+	* Gets the number of SID writes (summed over all used SIDs) that have been
+	* seen by the digi detection, and the number of those writes that actually
+	* had to be checked by the full detectors (see DigiDetector::detectSample()).
+	*/
+	static uint32_t getGlobalDigiWriteCount();
+	static uint32_t getGlobalDigiDetectCount();
+
+	/**
+	* Enables the recording of note events, i.e. gate on/off and the frequency
+	* or waveform changes while the gate is on (default: off). Changes that
+	* follow within about one raster line (e.g. the two halves of a frequency
+	* update) are merged into the previous event of the same voice.
+	*/
+	static void setNoteEvents(bool on);
+
+	/**
+	* Gets the note events recorded since the last clearNoteEvents() call
+	* (events that do not fit into the NOTE_BUF_SIZE buffer are dropped).
+	*/
+	static const NoteEvent* getNoteEvents(uint32_t* count);
+	static void clearNoteEvents();
 	
 	/**
 	* Allows to mute/unmute a spectific voice.
@@ -194,10 +285,52 @@ public:
 
 	/**
 	* Renders the combined output of all currently used SIDs.
+	*
+	* Output is either int16 (clipped) or float (-1..1 range, not clipped).
+	*
+	* @param dest receives one stereo sample: left channel in dest[0] and
+	*             right channel in dest[right]
+	* @param offset position used in the synth_trace_bufs
 	*/
-	static void	synthSamplesSingleSID(int16_t* buffer, int16_t** synth_trace_bufs, uint32_t offset);
-	static void synthSamplesMultiSID(int16_t* buffer, int16_t** synth_trace_bufs, uint32_t offset);
-	static void	synthSamplesStrippedMultiSID(int16_t* buffer, int16_t** synth_trace_bufs, uint32_t offset);
+	template <typename T>
+	static void	synthSamplesSingleSID(T* dest, uint32_t right, int16_t** synth_trace_bufs, uint32_t offset);
+	template <typename T>
+	static void synthSamplesMultiSID(T* dest, uint32_t right, int16_t** synth_trace_bufs, uint32_t offset);
+	template <typename T>
+	static void	synthSamplesStrippedMultiSID(T* dest, uint32_t right, int16_t** synth_trace_bufs, uint32_t offset);
+
+	/**
+	* Mixes the digi samples that have been recorded while the specified block
+	* was rendered into that block.
+	*
+	* @param step distance between two successive samples of the same channel
+	* @param right offset of the right channel (see synthSamplesSingleSID())
+	* @param start_ts system cycle at the start of the block
+	* @param start_offset already elapsed cycles of the 1st sample of the block
+	*                     (see _sample_cycles in core.cpp)
+	*/
+	template <typename T>
+	static void mixDigiSamples(T* synth_buffer, uint32_t step, uint32_t right, int16_t** synth_trace_bufs,
+								uint16_t samples, uint32_t start_ts, double start_offset);
+
+	/**
+	* Drops the digi samples recorded so far, i.e. used instead of
+	* mixDigiSamples() when nothing was rendered.
+	*/
+	static void discardDigiSamples();
+
+	/**
+	* Tells if mixDigiSamples() currently adds digi samples to the output,
+	* i.e. if int16 output should be rendered with some headroom (see
+	* clipSamples()) so that the combined output is only clipped once.
+	*/
+	static bool isDigiMixed();
+
+	/**
+	* Converts unclipped int32 output (e.g. synthSamplesSingleSID<int32_t>) to
+	* the clipped int16 output.
+	*/
+	static void clipSamples(const int32_t* in, int16_t* out, uint32_t len);
 
 	
 	// ---------- HW configuration -----------------
@@ -244,11 +377,44 @@ private:
 	
 	void		resetEngine(uint32_t sample_rate, bool set_6581, uint32_t clock_rate);
 	void		clockWaveGenerators();
+
+	// voices that are known to not contribute anything but a constant
+	// output are put to "sleep", i.e. they are no longer clocked
+	void		clockSelectedVoices();
+	void		trySleep();
+	void		wakeVoice(uint8_t voice_idx);
+	void		wakeUp();
+
+	// see setSegmentedMode()
+	void		updateClockMasks();
+	void		catchUp();
+
+	// see mixDigiSamples()
+	template <typename T>
+	void		mixDigi(T* dest, uint32_t step, uint32_t right, int16_t** synth_trace_bufs, uint16_t samples,
+						uint32_t start_ts, double start_offset, double cycles_per_sample);
+	void		getDigiLevels(const DigiSample* s, DigiMixMode mode, float* l, float* r,
+						float* scope, uint8_t* scope_idx);
+
+	// see setNoteEvents(); called before the write is applied
+	void		recordNoteEvent(uint8_t voice_idx, uint8_t reg, uint8_t val);
 	
+private:
+	// hot: per-cycle state
+	WaveGenerator	_wave_generators[3];
+	Envelope		_env_generators[3];
+
+	uint8_t			_osc_clock_mask;	// bit per voice: 1= oscillator is clocked per cycle
+	uint8_t			_env_clock_mask;	// bit per voice: 1= envelope is clocked per cycle
+	uint32_t		_synced_ticks;		// clockAll() count that the deferred state is synced to
+
+	uint8_t			_sleep_mask;	// bit per voice: 1= sleeping
+	uint32_t		_sleep_ticks[3];	// clockAll() count when voice went to sleep
+
+	// warm: per-sample state
+	Filter*			_filter;		// currently used model, i.e. one of below
+
 protected:
-	bool			_is_6581;
-	uint8_t			_bus_write;	// bus bahavior for "write only" registers
-	
 	// SID model specific distortions (based on resid's analysis)
 	int32_t			_wf_zero;
 	int32_t			_dac_offset;
@@ -256,23 +422,36 @@ protected:
 
 	float			_pan_left[3];
 	float			_pan_right[3];
-	
-	DigiDetector*	_digi;
+
+private:
+	// internal state of external filter
+	synth_coeff_t _cutoff_high_pass_ext;
+		// left
+	synth_t _left_lp_out;		// previous "low pass" output of external filter
+	synth_t _left_hp_out;		// previous "high pass" output of external filter
+		// right
+	synth_t _right_lp_out;		// previous "low pass" output of external filter
+	synth_t _right_hp_out;		// previous "high pass" output of external filter
+		// digi channel (see mixDigi())
+	double _digi_left_lp_out;
+	double _digi_left_hp_out;
+	double _digi_right_lp_out;
+	double _digi_right_hp_out;
+	double _digi_left_carry;	// part of the next output sample's kernel that has already been integrated
+	double _digi_right_carry;
+
+protected:
+	// cold: configuration
+	bool			_is_6581;
+	uint8_t			_bus_write;	// bus bahavior for "write only" registers
 private:
-	WaveGenerator*	_wave_generators[3];
-	Envelope*		_env_generators[3];
-	Filter*			_filter;
-	
 	uint16_t		_addr;			// start memory address that the SID is mapped to
 
-	// internal state of external filter
-	double _cutoff_high_pass_ext;
-		// left 
-	double _left_lp_out;		// previous "low pass" output of external filter
-	double _left_hp_out;		// previous "high pass" output of external filter	
-		// right 
-	double _right_lp_out;		// previous "low pass" output of external filter
-	double _right_hp_out;		// previous "high pass" output of external filter	
+	Filter6581		_filter6581;
+	Filter8580		_filter8580;
+
+protected:
+	DigiDetector	_digi;		// last since it contains the rather big side buffer
 };
 
 #endif
@@ -31,6 +31,7 @@
 #ifdef EMSCRIPTEN
 #include <emscripten.h>
 #else
+#include <time.h>
 #define EMSCRIPTEN_KEEPALIVE
 #endif
 
@@ -44,6 +45,7 @@ extern "C" {
 }
 #include "filter6581.h"
 #include "sid.h"
+#include "spectrum.h"
 extern "C" uint8_t	sidReadMem(uint16_t addr);
 extern "C" void 	sidWriteMem(uint16_t addr, uint8_t value);
 extern "C" uint8_t	sidReadVoiceLevel(uint8_t sid_idx, uint8_t voice_idx);
@@ -74,31 +76,91 @@ static LVCS_Params_t _lvcs_params;
 static uint32_t _procBufSize = 0;
 
 // keep it down to one screen to allow for
-// more direct feedback to WebAudio side:
-#define BUFLEN 96000/50
+// more direct feedback to WebAudio side: max number of stereo samples per
+// block, i.e. one frame at the used sample rate (but at least MIN_BUFLEN)
+#define MIN_BUFLEN (96000/50)
+#define MAX_SAMPLE_RATE 192000
+#define MAX_LVCS_SAMPLE_RATE 48000	// "pseudo stereo" limitation
 #define CHANNELS 2
 
-static int16_t 		_soundBuffer[BUFLEN * CHANNELS];
+static uint32_t		_buf_len = MIN_BUFLEN;
+
+static uint32_t getBufLen(uint32_t sample_rate) {
+	uint32_t len = (sample_rate + 49) / 50;	// PAL, i.e. the longer frame
+	return len < MIN_BUFLEN ? MIN_BUFLEN : len;
+}
+
+// the block that was rendered by the last computeAudioSamples(), i.e. either
+// the internal _synth_buffer, a buffer provided by the host or one slot of
+// the output ring (in the latter cases no copies are made)
+static void*		_sound_buffer = 0;
+static void*		_ext_sound_buffer = 0;	// see setOutputBuffer()
+
+// format of the output samples (see setOutputFormat())
+#define OUTPUT_INT16			0	// interleaved int16 stereo samples
+#define OUTPUT_FLOAT			1	// interleaved float32 stereo samples
+#define OUTPUT_FLOAT_PLANAR		2	// float32 left channel block followed by the right channel block
+
+static uint8_t		_output_format = OUTPUT_INT16;
+static uint8_t		_clip_float = 0;
+
+// optional host provided single-producer/single-consumer ring of output
+// blocks (see setOutputRing()). flat layout (uint32 words):
+//  [0]				number of blocks written so far (updated by the emulator)
+//  [1]				number of blocks read so far (updated by the host)
+//  [2]				number of slots
+//  [3]				capacity of each slot in stereo samples (see getMaxBlockLen())
+//  [4]				output format of the slots (see setOutputFormat())
+//  [5..5+slots)	number of stereo samples actually stored in the respective slot
+//  followed by the slots, each "capacity" stereo samples in the output format
+//  (a planar block has its right channel directly after its actual samples)
+#define RING_WRITE		0
+#define RING_READ		1
+#define RING_SLOTS		2
+#define RING_CAPACITY	3
+#define RING_FORMAT		4
+#define RING_LEN		5
+
+static uint32_t*	_output_ring = 0;
+
+// max number of samples that can be rendered into one block
+static uint32_t getBlockCapacity() {
+	if (_output_ring && (_output_ring[RING_CAPACITY] < _buf_len)) {
+		return _output_ring[RING_CAPACITY];	// ring was setup for a lower sample rate
+	}
+	return _buf_len;
+}
 
 // max 10 sids*4 voices (1 digi channel)
 #define MAX_SIDS 			10
 #define MAX_VOICES 			40
 #define MAX_SCOPE_BUFFERS 	40
 
-// output "scope" streams corresponding to final audio buffer
+// output "scope" streams corresponding to final audio buffer: the synthesis
+// writes directly into these (see getTraceBufs()). By default each block
+// starts at the beginning of the buffers. Alternatively they can be used as
+// rings (see setTraceRing()) where each block continues at the write index.
 static int16_t* 	_scope_buffers[MAX_SCOPE_BUFFERS];
+static uint32_t		_trace_ring[2] = { 0, MIN_BUFLEN };	// write index (samples written so far), capacity
+static bool			_is_trace_ring = false;
+static uint32_t		_trace_ring_cfg = 0;	// see setTraceRing()
 
 // these buffers are "per frame" i.e. 1 screen refresh, e.g. 822 samples
-static int16_t* 	_synth_buffer = 0;
-static int16_t** 	_synth_trace_buffers = 0;
+static void* 		_synth_buffer = 0;
 
 static uint16_t 	_chunk_size; 	// number of samples per call
+static uint16_t		_frame_pos;		// samples of the current frame that render() has already produced
+static uint16_t		_silent_len;	// samples at the start of the current frame emulated by skipSilentFrames()
+
+// optional analysis of each block: master output + trace streams (see setSpectrum())
+static Spectrum		_spectrum;
+static uint16_t		_spectrum_size = 0;
+static uint8_t		_spectrum_voices = 0;
 
 static uint32_t 	_number_of_samples_rendered = 0;
-static uint32_t 	_number_of_samples_to_render = 0;
 
 static uint8_t	 	_sound_started;
-static uint8_t	 	_skip_silence_loop;
+static double	 	_skip_silence_budget = 5;	// in ms, see setSkipSilenceBudget()
 
 static uint32_t		_sample_rate;
 
@@ -209,46 +271,46 @@ extern "C" void setPanning(uint8_t sid_idx, uint8_t voice_idx, float panning) {
 #define REGS2RECORD (25 + 3)	// only the first 25 regs (trailing paddle regs (etc) are ignored) - but adding "envelope levels" of all three voices
 
 
-static uint8_t** _sidRegSnapshots = 0;
+// flat layout: [sid][buffer 0/1][snapshot][register], i.e. each SID uses
+// 2*_sidRegSnapshotMax snapshots of REGS2RECORD bytes (see getSIDRegSnapshots())
+static uint8_t* _sidRegSnapshots = 0;
 static uint32_t _sidSnapshotSmplCount = 0;
 static uint32_t _sidSnapshotToggle = 0;
 
-static uint16_t _sidRegSnapshotAlloc = 0;
 static uint32_t _sidRegSnapshotPos = 0;
 static uint16_t _sidRegSnapshotMax = 0;
 
 
-static void initSidRegSnapshotBuffers() {
-	_sidSnapshotSmplCount = 0;
-
-	if (!_sidRegSnapshots) {
-		_sidRegSnapshots = (uint8_t**) calloc(MAX_SIDS, sizeof(uint8_t*));
-	}
-
-	uint16_t nSnapshots = (uint16_t)ceil((float)_procBufSize / _chunk_size);	// interval different from UI's "ticks" based calcs
-
-	if (_sidRegSnapshotAlloc < nSnapshots) {
-		for (uint8_t i = 0; i<MAX_SIDS; i++) {
-			if (_sidRegSnapshots[i]) free(_sidRegSnapshots[i]);
+static uint16_t getSidRegSnapshotCount() {
+	return (uint16_t)ceil((float)_procBufSize / _chunk_size);	// interval different from UI's "ticks" based calcs
+}
 
-			_sidRegSnapshots[i] = (uint8_t*)calloc(REGS2RECORD, nSnapshots * 2);	// double buffer the duration of WebAudio buffer
-		}
+// "buf" must hold the double buffered (duration of WebAudio buffer) snapshots
+// of MAX_SIDS
+static void initSidRegSnapshotBuffers(uint8_t* buf) {
+	_sidSnapshotSmplCount = 0;
 
-		_sidRegSnapshotAlloc = nSnapshots;
-	} else {
-		// just leave excess size unused
-	}
-	_sidRegSnapshotMax = nSnapshots;
+	_sidRegSnapshots = buf;
+	_sidRegSnapshotMax = getSidRegSnapshotCount();
 	_sidRegSnapshotPos = 0;
 	_sidSnapshotToggle = 0;
 }
 
+static uint8_t* getSidRegSnapshot(uint8_t sidIdx, uint32_t pos) {
+	return _sidRegSnapshots + (sidIdx * 2 * _sidRegSnapshotMax + pos) * REGS2RECORD;
+}
+
+// maps a WebAudio-side playback time (in 256-sample ticks) to the snapshot of the respective buffer
+static uint8_t* getSidRegSnapshot(uint8_t sidIdx, uint8_t bufIdx, uint32_t tick) {
+	uint32_t idx = (tick << 8) / _chunk_size;
+	return getSidRegSnapshot(sidIdx, (bufIdx ? _sidRegSnapshotMax : 0) + idx);
+}
+
 extern "C" uint16_t getSIDRegister(uint8_t sidIdx, uint16_t reg) __attribute__((noinline));
 
 static void recordSidRegSnapshot() {
-	uint32_t offset = _sidRegSnapshotPos * REGS2RECORD;
 	for (uint8_t i = 0; i < SID::getNumberUsedChips(); i++) {
-		uint8_t* sidBuf = &(_sidRegSnapshots[i][offset]);
+		uint8_t* sidBuf = getSidRegSnapshot(i, _sidRegSnapshotPos);
 
 		uint16_t j;
 		for (j = 0; j < REGS2RECORD-3; j++) {
@@ -287,11 +349,7 @@ extern "C" uint16_t EMSCRIPTEN_KEEPALIVE getSIDRegister2(uint8_t sidIdx, uint16_
 		// map the respective input to the corresponding cache block (the imprecision should not be relevant
 		// for the actual use cases.. see "piano view" in DeepSid)
 
-		uint8_t* sidBuf = &(_sidRegSnapshots[sidIdx][bufIdx ? _sidRegSnapshotMax*REGS2RECORD : 0]);
-		uint32_t idx = (tick << 8) / _chunk_size;
-
-		sidBuf += idx * REGS2RECORD;
-		return sidBuf[reg];
+		return getSidRegSnapshot(sidIdx, bufIdx, tick)[reg];
 	} else {
 		// fallback to latest state of emulator
 		return getSIDRegister(sidIdx, reg);
@@ -301,11 +359,75 @@ extern "C" uint16_t EMSCRIPTEN_KEEPALIVE getSIDRegister2(uint8_t sidIdx, uint16_
 extern "C" uint16_t readVoiceLevel(uint8_t sidIdx, uint8_t voiceIdx, uint8_t bufIdx, uint32_t tick) __attribute__((noinline));
 extern "C" uint16_t EMSCRIPTEN_KEEPALIVE readVoiceLevel(uint8_t sidIdx, uint8_t voiceIdx, uint8_t bufIdx, uint32_t tick) {
 
-	uint8_t* sidBuf = &(_sidRegSnapshots[sidIdx][bufIdx ? _sidRegSnapshotMax*REGS2RECORD : 0]);
-	uint32_t idx = (tick << 8) / _chunk_size;
-	sidBuf += idx * REGS2RECORD;
+	return getSidRegSnapshot(sidIdx, bufIdx, tick)[REGS2RECORD -3 + voiceIdx];
+}
 
-	return 	sidBuf[REGS2RECORD -3 + voiceIdx];
+// Bulk access to the recorded snapshots, e.g. to view them as one typed array
+// on the JavaScript side instead of using one getSIDRegister2()/readVoiceLevel()
+// call per value. Flat layout: [sid][buffer 0/1][snapshot][register]
+// i.e. the value of "reg" is found at byte
+//
+//	((sidIdx * 2 + bufIdx) * snapshots + (tick * 256) / samples) * regs + reg
+//
+// where getSIDRegSnapshotLayout() supplies:
+//	[0] snapshots:	number of snapshots per buffer
+//	[1] regs:		bytes per snapshot, i.e. the first 25 SID registers followed
+//					by the envelope levels of the 3 voices
+//	[2] samples:	number of samples between two snapshots (one frame)
+//	[3] number of used SIDs
+//
+// The layout only changes with playTune() and envSetNTSC().
+extern "C" uint8_t* getSIDRegSnapshots() __attribute__((noinline));
+extern "C" uint8_t* EMSCRIPTEN_KEEPALIVE getSIDRegSnapshots() {
+	return _sidRegSnapshots;
+}
+
+// in bytes (for the used SIDs)
+extern "C" uint32_t getSIDRegSnapshotsLen() __attribute__((noinline));
+extern "C" uint32_t EMSCRIPTEN_KEEPALIVE getSIDRegSnapshotsLen() {
+	return SID::getNumberUsedChips() * 2 * _sidRegSnapshotMax * REGS2RECORD;
+}
+
+extern "C" uint32_t* getSIDRegSnapshotLayout() __attribute__((noinline));
+extern "C" uint32_t* EMSCRIPTEN_KEEPALIVE getSIDRegSnapshotLayout() {
+	static uint32_t layout[4];
+	layout[0] = _sidRegSnapshotMax;
+	layout[1] = REGS2RECORD;
+	layout[2] = _chunk_size;
+	layout[3] = SID::getNumberUsedChips();
+	return layout;
+}
+
+// Note events (gate on/off, frequency/waveform changes) recorded at the exact
+// cycle of the respective SID writes, e.g. for piano-roll style displays. When
+// enabled, each computeAudioSamples()/render() call collects the events of the
+// emulation it performed, i.e. the respective getNoteEvents() array must be
+// consumed before the next call. Each event is 12 bytes:
+//
+//	[0] uint32 ts:		system cycle of the write (counted from the song start)
+//	[4] uint16 freq:	oscillator frequency register
+//	[6] uint8 sid:		index of the SID
+//	[7] uint8 voice:	0..2
+//	[8] uint8 type:		1= gate on, 2= gate off, 3= frequency/waveform change
+//	[9] uint8 ctrl:		control register (waveform and gate bits)
+//	[10] uint8 ad:		attack/decay register
+//	[11] uint8 sr:		sustain/release register
+extern "C" void enableNoteEvents(uint8_t on) __attribute__((noinline));
+extern "C" void EMSCRIPTEN_KEEPALIVE enableNoteEvents(uint8_t on) {
+	SID::setNoteEvents(on);
+}
+
+extern "C" uint8_t* getNoteEvents() __attribute__((noinline));
+extern "C" uint8_t* EMSCRIPTEN_KEEPALIVE getNoteEvents() {
+	uint32_t count;
+	return (uint8_t*)SID::getNoteEvents(&count);
+}
+
+extern "C" uint32_t getNoteEventCount() __attribute__((noinline));
+extern "C" uint32_t EMSCRIPTEN_KEEPALIVE getNoteEventCount() {
+	uint32_t count;
+	SID::getNoteEvents(&count);
+	return count;
 }
 
 static void resetTimings(uint8_t is_ntsc) {
@@ -318,72 +440,111 @@ static void resetTimings(uint8_t is_ntsc) {
 	SID::resetAll(_sample_rate, clock_rate, is_rsid, is_compatible);
 }
 
-static void resetScopeBuffers() {
-	if (_scope_buffers[0] == 0) {
-		// alloc once
-		for (int i= 0; i<MAX_SCOPE_BUFFERS; i++) {
-			_scope_buffers[i] = (int16_t*) calloc(BUFLEN, sizeof(int16_t));
-		}
-	} else {
-		for (int i= 0; i<MAX_SCOPE_BUFFERS; i++) {
-			// just to make sure there is no garbage left
-			memset(_scope_buffers[i], 0, sizeof(int16_t)*BUFLEN);
-		}
+static uint32_t getScopeBufferCapacity() {
+	return _trace_ring_cfg < _buf_len ? _buf_len : _trace_ring_cfg;
+}
+
+// number of separately stored scope buffers: the remaining ones all share
+// one buffer that just stays silent
+static uint8_t getScopeBufferCount() {
+	return _trace_sid ? SID::getNumberUsedChips() * 4 : 0;
+}
+
+// "buf" must hold getScopeBufferCount() + 1 buffers of "size" bytes
+static void resetScopeBuffers(uint8_t* buf, uint32_t size) {
+	_is_trace_ring = _trace_ring_cfg > 0;
+
+	uint8_t count = getScopeBufferCount();
+	for (int i= 0; i<MAX_SCOPE_BUFFERS; i++) {
+		_scope_buffers[i] = (int16_t*)(buf + (i < count ? i : count) * size);
 	}
+	_trace_ring[0] = 0;
+	_trace_ring[1] = getScopeBufferCapacity();
 }
 
-static void resetSynthBuffer(uint16_t size) {
-	if (_synth_buffer) free(_synth_buffer);
+// Gets the trace buffers to be used for the samples starting at "pos" of the
+// current block (or 0 if tracing is off). "len" is reduced as needed so that
+// the respective samples do not cross the end of a trace ring.
+static int16_t** getTraceBufs(uint32_t pos, uint32_t* len) {
+	static int16_t* traces[MAX_SCOPE_BUFFERS];
+
+	if (!_trace_sid) return 0;
 
-	_synth_buffer= (int16_t*)malloc(sizeof(int16_t)*
-						(size * CHANNELS + 1));
+	uint32_t idx = _is_trace_ring ? (_trace_ring[0] + pos) % _trace_ring[1] : pos;
+	if (*len > _trace_ring[1] - idx) *len = _trace_ring[1] - idx;
+
+	for (int i= 0; i<MAX_SCOPE_BUFFERS; i++) {
+		traces[i] = _scope_buffers[i] + idx;
+	}
+	return traces;
 }
 
-static void discardSynthTraceBuffers() {
-	// trace output (corresponding to _synth_buffer)
-	if (_synth_trace_buffers) {
-		for (int i= 0; i<MAX_VOICES; i++) {
-			if (_synth_trace_buffers[i]) {
-				free(_synth_trace_buffers[i]);
-				_synth_trace_buffers[i] = 0;
-			}
-		}
-		free(_synth_trace_buffers);
-		_synth_trace_buffers = 0;
+static void publishTraces(uint32_t samples) {
+	if (_is_trace_ring) {
+		// the host must not see the new write index before the data is complete
+		__atomic_store_n(&_trace_ring[0], _trace_ring[0] + samples, __ATOMIC_RELEASE);
 	}
 }
 
-static void allocSynthTraceBuffers(uint16_t size) {
-	// availability of _synth_trace_buffers controls
-	// if SID will generate the respective output
+static void initSpectrum() {
+	// the trace streams only exist while tracing is on
+	uint8_t streams = 1 + (_spectrum_voices ? getScopeBufferCount() : 0);
+	_spectrum.configure(_spectrum_size, streams);
+}
 
-	if (_trace_sid) {
-		if (!_synth_trace_buffers) {
-			_synth_trace_buffers = (int16_t**)calloc(sizeof(int16_t*), MAX_VOICES);
-		}
-		for (int i= 0; i<MAX_VOICES; i++) {
-			_synth_trace_buffers[i] = (int16_t*)calloc(sizeof(int16_t), size + 1);
-		}
+// feeds the finished block to the spectrum analysis (before publishTraces())
+static void analyzeBlock(void* dest, uint32_t samples) {
+	if (!_spectrum.getSize()) return;
 
+	if (_output_format == OUTPUT_INT16) {
+		_spectrum.feed(0, (int16_t*)dest, CHANNELS, 1, samples);
+	} else if (_output_format == OUTPUT_FLOAT) {
+		_spectrum.feed(0, (float*)dest, CHANNELS, 1, samples);
 	} else {
-		if (_synth_trace_buffers) {
-			for (int i= 0; i<MAX_VOICES; i++) {
-				if (_synth_trace_buffers[i]) {
-					free(_synth_trace_buffers[i]);
-					_synth_trace_buffers[i] = 0;
-				}
-			}
-			free(_synth_trace_buffers);
-			_synth_trace_buffers = 0; // disables respective SID rendering
+		_spectrum.feed(0, (float*)dest, 1, samples, samples);
+	}
+
+	if (_trace_sid) {
+		// the block may wrap around the end of the trace rings
+		uint32_t idx = _is_trace_ring ? _trace_ring[0] % _trace_ring[1] : 0;
+		uint32_t len = samples < _trace_ring[1] - idx ? samples : _trace_ring[1] - idx;
+
+		for (uint8_t i= 1; i<_spectrum.getStreams(); i++) {
+			_spectrum.feed(i, _scope_buffers[i - 1] + idx, 1, 0, len);
+			_spectrum.feed(i, _scope_buffers[i - 1], 1, 0, samples - len);
 		}
 	}
+	_spectrum.analyze();
 }
 
-static void resetSynthTraceBuffers(uint16_t size) {
-	discardSynthTraceBuffers();
-	allocSynthTraceBuffers(size);
+// All the buffers that depend on the song (number of SIDs, timing) or on the
+// configuration (tracing, trace ring, etc) are carved out of one arena. The
+// arena only grows when a song needs more than any of its predecessors, i.e.
+// it is otherwise reused and playing long playlists causes no allocator churn.
+#define ARENA_ALIGN 16		// e.g. for SIMD access
+
+static uint8_t*		_arena = 0;
+static uint32_t		_arena_size = 0;
+
+static uint32_t alignArena(uint32_t size) {
+	return (size + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1);
 }
 
+// gets "size" cleared (and aligned) bytes from the start of the arena
+static uint8_t* resetArena(uint32_t size) {
+	static uint8_t* base = 0;
+
+	if (size > _arena_size) {
+		free(_arena);
+
+		_arena = (uint8_t*)malloc(size + ARENA_ALIGN);
+		_arena_size = size;
+
+		base = (uint8_t*)(((size_t)_arena + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1));
+	}
+	memset(base, 0, size);
+	return base;
+}
 
 static void resetAudioBuffers() {
 
@@ -394,14 +555,29 @@ static void resetAudioBuffers() {
 
 	_chunk_size = _sample_rate / vicFramesPerSecond();
 
-	resetScopeBuffers();
-	resetSynthBuffer(_chunk_size);
-	resetSynthTraceBuffers(_chunk_size);
+	// render() may use blocks that are larger than one frame, and the
+	// buffers must be large enough for any of the output formats
+	uint32_t synth_size = alignArena(sizeof(float) * (_buf_len * CHANNELS + 1));
+	uint32_t scope_size = alignArena(sizeof(int16_t) * getScopeBufferCapacity());
+	uint32_t scope_total = scope_size * (getScopeBufferCount() + 1);
+	uint32_t snapshot_size = alignArena(MAX_SIDS * 2 * getSidRegSnapshotCount() * REGS2RECORD);
+
+	uint8_t* buf = resetArena(synth_size + scope_total + snapshot_size);
+
+	_synth_buffer = buf;
+	buf += synth_size;
+
+	resetScopeBuffers(buf, scope_size);
+	buf += scope_total;
+
+	initSidRegSnapshotBuffers(buf);
 
 	_number_of_samples_rendered = 0;
-	_number_of_samples_to_render = 0;
+	_frame_pos = 0;
+	_silent_len = 0;
+	_sound_buffer = _synth_buffer;
 
-	initSidRegSnapshotBuffers();
+	initSpectrum();
 }
 
 extern "C" uint8_t envSetNTSC(uint8_t is_ntsc)  __attribute__((noinline));
@@ -414,102 +590,271 @@ extern "C" uint8_t EMSCRIPTEN_KEEPALIVE envSetNTSC(uint8_t is_ntsc) {
 
 // ----------------- generic handling -----------------------------------------
 
-inline void applyStereoEnhance() {
+inline void applyStereoEnhance(void* buffer, uint16_t len) {
+	// LVCS only handles int16
+	if ((_output_format != OUTPUT_INT16) || (_sample_rate > MAX_LVCS_SAMPLE_RATE)) return;
+
 	uint32_t s;
-	if((_effect_level > 0) && (s = LVCS_Process(_lvcs_handle, (const LVM_INT16*)_synth_buffer, _synth_buffer, _chunk_size))) {
-		fprintf(stderr, "error: LVCS_Process %lu %hu\n", s, _chunk_size);
+	if((_effect_level > 0) && (s = LVCS_Process(_lvcs_handle, (const LVM_INT16*)buffer, (LVM_INT16*)buffer, len))) {
+		fprintf(stderr, "error: LVCS_Process %lu %hu\n", s, len);
 	}
 }
 
+static uint32_t getSampleSize(uint8_t format) {
+	return format == OUTPUT_INT16 ? sizeof(int16_t) : sizeof(float);
+}
+
+static uint32_t getOutputSampleSize() {
+	return getSampleSize(_output_format);
+}
+
+static void clipFloat(float* buffer, uint32_t len) {
+	for (uint32_t i= 0; i<len; i++) {
+		if (buffer[i] < -1.0f) {
+			buffer[i] = -1.0f;
+		} else if (buffer[i] > 1.0f) {
+			buffer[i] = 1.0f;
+		}
+	}
+}
+
+// Gets the location where the next block must be rendered to.
+static void* getOutputBlock() {
+	if (_output_ring) {
+		uint32_t w = _output_ring[RING_WRITE];
+		uint32_t r = __atomic_load_n(&_output_ring[RING_READ], __ATOMIC_ACQUIRE);
+		uint32_t slots = _output_ring[RING_SLOTS];
+
+		if (w - r >= slots) return 0;	// full
+
+		// (the slots are laid out for the format used when the ring was set up)
+		uint8_t* data = (uint8_t*)(_output_ring + RING_LEN + slots);
+		return data + (w % slots) * _output_ring[RING_CAPACITY] * CHANNELS * getSampleSize(_output_ring[RING_FORMAT]);
+	}
+	return _ext_sound_buffer ? _ext_sound_buffer : _synth_buffer;
+}
+
+static void publishOutputBlock() {
+	if (_output_ring) {
+		uint32_t w = _output_ring[RING_WRITE];
+		_output_ring[RING_LEN + (w % _output_ring[RING_SLOTS])] = _number_of_samples_rendered;
+
+		// the host must not see the new block before its data is complete
+		__atomic_store_n(&_output_ring[RING_WRITE], w + 1, __ATOMIC_RELEASE);
+	}
+}
+
+// renders the next "len" samples of the current frame to the "pos" of the block
+static void renderSlice(void* dest, uint32_t pos, uint32_t block_len, uint32_t len, uint8_t is_simple_sid_mode,
+						bool trace) {
+	while (len) {
+		uint32_t n = len;	// might be reduced by the end of the trace rings
+		int16_t** trace_bufs = trace ? getTraceBufs(pos, &n) : 0;
+
+		if (_output_format == OUTPUT_INT16) {
+			Core::runSlice(is_simple_sid_mode, (int16_t*)dest + pos * CHANNELS, trace_bufs, n);
+		} else if (_output_format == OUTPUT_FLOAT) {
+			Core::runSlice(is_simple_sid_mode, (float*)dest + pos * CHANNELS, CHANNELS, 1, trace_bufs, n);
+		} else {
+			Core::runSlice(is_simple_sid_mode, (float*)dest + pos, 1, block_len, trace_bufs, n);
+		}
+		pos += n;
+		len -= n;
+	}
+}
+
+// fills the next "len" samples of the block (starting at "pos") with the
+// silence that was emulated by skipSilentFrames()
+static void silenceSlice(void* dest, uint32_t pos, uint32_t block_len, uint32_t len) {
+	uint32_t size = getOutputSampleSize();
+
+	if (_output_format == OUTPUT_FLOAT_PLANAR) {
+		memset((float*)dest + pos, 0, len * size);
+		memset((float*)dest + block_len + pos, 0, len * size);
+	} else {
+		memset((uint8_t*)dest + pos * CHANNELS * size, 0, len * CHANNELS * size);
+	}
+	while (len) {
+		uint32_t n = len;
+		int16_t** trace_bufs = getTraceBufs(pos, &n);
+		if (!trace_bufs) break;
+
+		for (int i= 0; i<MAX_SCOPE_BUFFERS; i++) {
+			memset(trace_bufs[i], 0, n * sizeof(int16_t));
+		}
+		pos += n;
+		len -= n;
+	}
+}
+
+// wall-clock time in ms
+static double getTimeMs() {
+#ifdef EMSCRIPTEN
+	return emscripten_get_now();
+#else
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+#endif
+}
+
+// Fast forwards through the silent intro of a song (e.g. songs that first
+// run some slow BASIC code): the respective frames are emulated without any
+// synthesis (see Core::skipSilence()). Starts the next frame(s) and returns
+// the number of samples at the start of the current frame that have been
+// skipped, i.e. the remainder of the frame during which the song becomes
+// audible must then be rendered regularly.
+static uint16_t skipSilentFrames(uint8_t is_simple_sid_mode, uint8_t speed, double deadline) {
+	// limit "skipping" so as not to make the browser unresponsive (at least
+	// the one frame that is needed for the current output is always emulated)
+	do {
+		Core::startFrame(speed);
+
+		uint16_t skipped = Core::skipSilence(is_simple_sid_mode, _chunk_size);
+		if (skipped < _chunk_size) {
+			_sound_started = 1;
+			return skipped;
+		}
+	} while (getTimeMs() < deadline);
+
+	return _chunk_size;	// still silent
+}
+
+// Renders exactly the requested number of samples (max getMaxBlockLen()), i.e. unlike
+// computeAudioSamples() this is not limited to whole frames and the host can
+// use whatever block size suits its needs (e.g. 128 for an AudioWorklet). The
+// once-per-frame handling (register snapshots, end of track detection, etc)
+// still follows the regular frame schedule. The rendered samples are
+// available in the same way as those of computeAudioSamples(). Returns -1 when
+// the end of the track was reached within the rendered block.
+extern "C" int32_t render(uint32_t samples)  __attribute__((noinline));
+extern "C" int32_t EMSCRIPTEN_KEEPALIVE render(uint32_t samples) {
+	if(!_ready_to_play) return 0;
+
+	uint8_t is_simple_sid_mode =	!FileLoader::isExtendedSidFile();
+	uint8_t speed =					FileLoader::getCurrentSongSpeed();
+
+	_number_of_samples_rendered = 0;
+
+	if (samples > getBlockCapacity()) samples = getBlockCapacity();
+
+	void* dest = getOutputBlock();
+	if (!dest) return 0;	// ring is full: the host first has to consume some blocks
+
+	SID::clearNoteEvents();
+
+	uint8_t is_track_end = 0;
+	uint32_t pos = 0;
+
+	// time budget for skipping a silent intro (shared by all frames of this call)
+	double skip_deadline = _sound_started ? 0 : getTimeMs() + _skip_silence_budget;
+
+	while (pos < samples) {
+		if (_frame_pos == 0) {
+			if (_sound_started) {
+				Core::startFrame(speed);
+				_silent_len = 0;
+			} else {
+				_silent_len = skipSilentFrames(is_simple_sid_mode, speed, skip_deadline);
+			}
+		}
+
+		uint32_t len = _chunk_size - _frame_pos;
+		if (len > samples - pos) len = samples - pos;
+
+		if (_frame_pos < _silent_len) {
+			if (len > (uint32_t)(_silent_len - _frame_pos)) len = _silent_len - _frame_pos;
+			silenceSlice(dest, pos, samples, len);
+		} else {
+			renderSlice(dest, pos, samples, len, is_simple_sid_mode, true);
+		}
+
+		pos += len;
+		_frame_pos += len;
+
+		if (_frame_pos == _chunk_size) {
+			_frame_pos = 0;
+
+			recordSidRegSnapshot();
+			is_track_end |= _loader->isTrackEnd();
+		}
+	}
+
+	applyStereoEnhance(dest, samples);
+	if ((_output_format != OUTPUT_INT16) && _clip_float) {
+		clipFloat((float*)dest, samples * CHANNELS);
+	}
+
+	_number_of_samples_rendered = samples;
+	_sound_buffer = dest;
+
+	analyzeBlock(dest, samples);
+
+	publishOutputBlock();
+	publishTraces(samples);
+
+	return is_track_end ? -1 : _number_of_samples_rendered;
+}
+
 // This is driving the emulation: Each call to computeAudioSamples() delivers
 // some fixed numberof audio samples and the necessary emulation timespan is
-// derived from it:
+// derived from it. The samples are rendered directly into their final
+// destination (see getOutputBlock()).
 
 extern "C" int32_t computeAudioSamples()  __attribute__((noinline));
 extern "C" int32_t EMSCRIPTEN_KEEPALIVE computeAudioSamples() {
 	if(!_ready_to_play) return 0;
 
 	uint8_t is_simple_sid_mode =	!FileLoader::isExtendedSidFile();
-	int sid_voices =				SID::getNumberUsedChips() * 4;
 	uint8_t speed =					FileLoader::getCurrentSongSpeed();
 
 #ifdef TEST
 	return 0;
 #endif
+	if (_frame_pos) {
+		// render() left an incomplete frame
+		return render(_chunk_size - _frame_pos);
+	}
+	if (_is_trace_ring || (_chunk_size > getBlockCapacity()) || !_sound_started) {
+		// the frame might have to be split at the end of the trace rings
+		// (or at the end of a too small output ring slot) and render() also
+		// handles the skipping of a song's silent intro
+		return render(_chunk_size);
+	}
 	_number_of_samples_rendered = 0;
 
-	uint32_t sample_buffer_idx = 0;
+	void* dest = getOutputBlock();
+	if (!dest) return 0;	// ring is full: the host first has to consume some blocks
 
-	while (_number_of_samples_rendered < _chunk_size) {
-		if (_number_of_samples_to_render == 0) {
-			_number_of_samples_to_render = _chunk_size;
-			sample_buffer_idx = 0;
+	SID::clearNoteEvents();
 
-			// limit "skipping" so as not to make the browser unresponsive
-			for (uint16_t i= 0; i<_skip_silence_loop; i++) {
+	// In addition to the actual sample data played by WebAudio, buffers
+	// containing raw voice data are also created here. These are 1:1 in
+	// sync with the sample buffer, i.e. for each sample entry in the
+	// sample buffer there is a corresponding entry in the additional
+	// buffers - which are all exactly the same size as the sample buffer.
+	uint32_t len = _chunk_size;
+	int16_t** trace_bufs = getTraceBufs(0, &len);
 
-				Core::runOneFrame(is_simple_sid_mode, speed, _synth_buffer,
-									_synth_trace_buffers, _chunk_size);
+	if (_output_format == OUTPUT_INT16) {
+		Core::runOneFrame(is_simple_sid_mode, speed, (int16_t*)dest,
+							trace_bufs, _chunk_size);
+	} else {
+		Core::runOneFrame(is_simple_sid_mode, speed, (float*)dest, _output_format == OUTPUT_FLOAT_PLANAR,
+							trace_bufs, _chunk_size);
+	}
+	applyStereoEnhance(dest, _chunk_size);
 
-				if (!_sound_started) {
-					if (SID::isAudible()) {
-						_sound_started = 1;
+	if ((_output_format != OUTPUT_INT16) && _clip_float) {
+		clipFloat((float*)dest, _chunk_size * CHANNELS);
+	}
 
-						applyStereoEnhance();
-						break;
-					}
-				} else {
-					applyStereoEnhance();
-					break;
-				}
-			}
-		}
+	_number_of_samples_rendered = _chunk_size;
+	_sound_buffer = dest;
 
-		if (_number_of_samples_rendered + _number_of_samples_to_render > _chunk_size) {
-			uint32_t available_space = _chunk_size-_number_of_samples_rendered;
-
-			memcpy(	&_soundBuffer[_number_of_samples_rendered],
-					&_synth_buffer[sample_buffer_idx],
-					sizeof(int16_t) * available_space * CHANNELS);
-
-			// In addition to the actual sample data played by WebAudio, buffers
-			// containing raw voice data are also created here. These are 1:1 in
-			// sync with the sample buffer, i.e. for each sample entry in the
-			// sample buffer there is a corresponding entry in the additional
-			// buffers - which are all exactly the same size as the sample buffer.
-
-			if (_trace_sid) {
-				// do the same for the respective voice traces
-				for (int i= 0; i<sid_voices; i++) {
-					if (is_simple_sid_mode || (sid_voices % 4) != 3) {	// no digi
-						memcpy(	&(_scope_buffers[i][_number_of_samples_rendered]),
-								&(_synth_trace_buffers[i][sample_buffer_idx]),
-								sizeof(int16_t) * available_space);
-					}
-				}
-			}
-			sample_buffer_idx += available_space;
-			_number_of_samples_to_render -= available_space;
-			_number_of_samples_rendered = _chunk_size;
-		} else {
-			memcpy(	&_soundBuffer[_number_of_samples_rendered],
-					&_synth_buffer[sample_buffer_idx],
-					sizeof(int16_t) * CHANNELS * _number_of_samples_to_render);
-
-			if (_trace_sid) {
-				// do the same for the respecive voice traces
-				for (int i= 0; i<sid_voices; i++) {
-					if (is_simple_sid_mode || (sid_voices % 4) != 3) {	// no digi
-						memcpy(	&(_scope_buffers[i][_number_of_samples_rendered]),
-								&(_synth_trace_buffers[i][sample_buffer_idx]),
-								sizeof(int16_t) * _number_of_samples_to_render);
-					}
-				}
-			}
-			_number_of_samples_rendered += _number_of_samples_to_render;
-			_number_of_samples_to_render = 0;
-		}
-	}
+	analyzeBlock(dest, _chunk_size);
+
+	publishOutputBlock();
 
 	recordSidRegSnapshot();
 
@@ -520,6 +865,67 @@ extern "C" int32_t EMSCRIPTEN_KEEPALIVE computeAudioSamples() {
 	return _number_of_samples_rendered;
 }
 
+// Selects the format of the rendered samples: 0= interleaved int16 (default),
+// 1= interleaved float32, 2= planar float32. The float32 output uses the -1..1
+// range and it is only clipped to that range when "clip" is set, i.e. it keeps
+// the headroom of multi-SID songs. The pseudo stereo effect is only available
+// for int16 output. Takes effect with the next computeAudioSamples().
+// The format cannot be changed while an output ring is used (its slots are
+// sized for the format it was set up with, see setOutputRing()), i.e. the
+// ring must first be disabled. Returns the format that is actually used.
+extern "C" uint8_t setOutputFormat(uint8_t format, uint8_t clip)  __attribute__((noinline));
+extern "C" uint8_t EMSCRIPTEN_KEEPALIVE setOutputFormat(uint8_t format, uint8_t clip) {
+	if (!_output_ring) {
+		_output_format = format > OUTPUT_FLOAT_PLANAR ? OUTPUT_INT16 : format;
+	}
+	_clip_float = clip;
+	return _output_format;
+}
+
+// Lets computeAudioSamples() render directly into the passed buffer (which
+// must have room for getMaxBlockLen() stereo samples in the output format), i.e.
+// getSoundBuffer() then just returns that buffer. 0 switches back to the
+// internal buffer.
+extern "C" void setOutputBuffer(void* buffer)  __attribute__((noinline));
+extern "C" void EMSCRIPTEN_KEEPALIVE setOutputBuffer(void* buffer) {
+	_ext_sound_buffer = buffer;
+}
+
+// Max number of stereo samples in one block, i.e. one frame at the sample rate
+// used by the last loadSidFile() (but at least 1920).
+extern "C" uint32_t getMaxBlockLen()  __attribute__((noinline));
+extern "C" uint32_t EMSCRIPTEN_KEEPALIVE getMaxBlockLen() {
+	return _buf_len;
+}
+
+// Size in bytes of an output ring with the specified number of slots (for the
+// current output format and the sample rate used by the last loadSidFile()),
+// i.e. the format must not be changed before the ring is passed to
+// setOutputRing().
+extern "C" uint32_t getOutputRingSize(uint32_t slots)  __attribute__((noinline));
+extern "C" uint32_t EMSCRIPTEN_KEEPALIVE getOutputRingSize(uint32_t slots) {
+	return (RING_LEN + slots) * sizeof(uint32_t) + slots * _buf_len * CHANNELS * getOutputSampleSize();
+}
+
+// Lets computeAudioSamples() render each block directly into the next free
+// slot of the passed ring (see layout above), e.g. memory that is shared with
+// an AudioWorklet. The host consumes the blocks at its own pace and signals
+// this by incrementing the "read" counter. While the ring is full
+// computeAudioSamples() does not emulate anything and just returns 0.
+// The current output format is recorded in the ring and it cannot be changed
+// while the ring is used (see setOutputFormat()). 0 disables the use of the ring.
+extern "C" void setOutputRing(uint32_t* ring, uint32_t slots)  __attribute__((noinline));
+extern "C" void EMSCRIPTEN_KEEPALIVE setOutputRing(uint32_t* ring, uint32_t slots) {
+	if (ring) {
+		ring[RING_WRITE] = 0;
+		ring[RING_READ] = 0;
+		ring[RING_SLOTS] = slots ? slots : 1;
+		ring[RING_CAPACITY] = _buf_len;
+		ring[RING_FORMAT] = _output_format;
+		memset(ring + RING_LEN, 0, ring[RING_SLOTS] * sizeof(uint32_t));
+	}
+	_output_ring = ring;
+}
 
 extern "C" uint32_t enableVoice(uint8_t sid_idx, uint8_t voice, uint8_t on)  __attribute__((noinline));
 extern "C" uint32_t EMSCRIPTEN_KEEPALIVE enableVoice(uint8_t sid_idx, uint8_t voice, uint8_t on) {
@@ -556,11 +962,11 @@ LVM_Fs_en getSampleRateEn(uint32_t sample_rate) {
 }
 
 void configurePseudoStereo() {
-	if (!_chunk_size) return;
+	if (!_chunk_size || (_sample_rate > MAX_LVCS_SAMPLE_RATE)) return;
 	
 	if (_lvcs_handle == LVM_NULL) {
 		// capabilities used for LVCS_Memory and LVCS_Init must be the same!
-		_lvcs_caps.MaxBlockSize= _chunk_size;
+		_lvcs_caps.MaxBlockSize= MIN_BUFLEN;	// see render() (higher sample rates are not supported)
 		_lvcs_caps.CallBack= LVM_NULL;
 
 		if (LVCS_Memory(LVM_NULL, &_lvcs_mem_tab, &_lvcs_caps)) {	// orig code patched to alloc used buffers!
@@ -629,6 +1035,45 @@ extern "C" void EMSCRIPTEN_KEEPALIVE setHeadphoneMode(uint8_t mode) {
 	configurePseudoStereo();
 }
 
+// "event-segmented" synthesis (see SID::setSegmentedMode()); may be
+// toggled at any time
+extern "C" void setSegmentedSynthesis(uint8_t on)  __attribute__((noinline));
+extern "C" void EMSCRIPTEN_KEEPALIVE setSegmentedSynthesis(uint8_t on) {
+	SID::setSegmentedMode(on);
+}
+
+// band-limited saw/pulse waveforms (see SID::setBandLimitedWaveforms()); may be
+// toggled at any time
+extern "C" void setBandLimitedWaveforms(uint8_t on)  __attribute__((noinline));
+extern "C" void EMSCRIPTEN_KEEPALIVE setBandLimitedWaveforms(uint8_t on) {
+	SID::setBandLimitedWaveforms(on);
+}
+
+// number of sub-samples that are rendered per output sample (1= off, max 8);
+// takes effect with the next playTune()
+extern "C" void setOversampling(uint8_t factor)  __attribute__((noinline));
+extern "C" void EMSCRIPTEN_KEEPALIVE setOversampling(uint8_t factor) {
+	SID::setOversampling(factor);
+}
+
+// max time in ms that each computeAudioSamples()/render() call may spend on
+// fast forwarding (without any synthesis) while the song has not become
+// audible yet (default: 5); the frames needed for the requested output are
+// always emulated, i.e. 0 disables the fast forwarding; hosts that can afford
+// to block longer may use larger values to skip long silent intros faster
+extern "C" void setSkipSilenceBudget(uint32_t ms)  __attribute__((noinline));
+extern "C" void EMSCRIPTEN_KEEPALIVE setSkipSilenceBudget(uint32_t ms) {
+	_skip_silence_budget = ms;
+}
+
+// internal rate of the filter (see SID::setFilterRate()), e.g. 88200; 0= once per
+// sample; the closest multiple of the sample rate is used (e.g. 96000 for 88200 at
+// 48kHz); takes effect with the next playTune()
+extern "C" void setFilterRate(uint32_t rate)  __attribute__((noinline));
+extern "C" void EMSCRIPTEN_KEEPALIVE setFilterRate(uint32_t rate) {
+	SID::setFilterRate(rate);
+}
+
 
 extern "C" uint32_t playTune(uint32_t selected_track, uint32_t trace_sid, uint32_t procBufSize)  __attribute__((noinline));
 extern "C" uint32_t EMSCRIPTEN_KEEPALIVE playTune(uint32_t selected_track, uint32_t trace_sid, uint32_t procBufSize) {
@@ -648,9 +1093,9 @@ extern "C" uint32_t EMSCRIPTEN_KEEPALIVE playTune(uint32_t selected_track, uint3
 	// "UI responsiveness" perspective it is preferable to attempt a "speedup"
 	// on limited slices from within the audio-rendering loop.
 
-	// should keep the UI responsive; means that on a fast machine the above
-	// garbage song will still take 10 secs before it plays
-	_skip_silence_loop = 10;
+	// the default limit of 5ms per rendered block should keep the UI
+	// responsive; means that the above garbage song will still take a while
+	// before it plays (see setSkipSilenceBudget())
 
 	// XXX FIXME the separate handling of the INIT call is an annoying legacy
 	// of the old impl.. respective PSID handling should better to moved into
@@ -679,7 +1124,8 @@ extern "C" uint32_t EMSCRIPTEN_KEEPALIVE loadSidFile(uint32_t is_mus, void* in_b
 								void* char_ROM, void* kernal_ROM) {
 
 	_ready_to_play = 0;											// stop any emulator use
-    _sample_rate = sample_rate > 48000 ? 48000 : sample_rate; 	// see hardcoded BUFLEN (and "pseudo stereo" limitation)
+    _sample_rate = sample_rate > MAX_SAMPLE_RATE ? MAX_SAMPLE_RATE : sample_rate;
+	_buf_len = getBufLen(_sample_rate);
 
 	_loader = FileLoader::getInstance(is_mus, in_buffer, in_buf_size);
 
@@ -708,7 +1154,7 @@ extern "C" uint32_t EMSCRIPTEN_KEEPALIVE getSoundBufferLen() {
 
 extern "C" char* getSoundBuffer() __attribute__((noinline));
 extern "C" char* EMSCRIPTEN_KEEPALIVE getSoundBuffer() {
-	return (char*) _soundBuffer;
+	return (char*) _sound_buffer;
 }
 
 extern "C" uint32_t getSampleRate() __attribute__((noinline));
@@ -788,6 +1234,18 @@ extern "C" uint16_t EMSCRIPTEN_KEEPALIVE getGlobalDigiRate() {
 	return (t > 0) ? SID::getGlobalDigiRate() : 0;
 }
 
+// diagnostics: SID writes seen by the digi detection since the start of the song
+extern "C" uint32_t getDigiWriteCount() __attribute__((noinline));
+extern "C" uint32_t EMSCRIPTEN_KEEPALIVE getDigiWriteCount() {
+	return SID::getGlobalDigiWriteCount();
+}
+
+// diagnostics: SID writes that passed the pre-filter of the digi detection
+extern "C" uint32_t getDigiDetectCount() __attribute__((noinline));
+extern "C" uint32_t EMSCRIPTEN_KEEPALIVE getDigiDetectCount() {
+	return SID::getGlobalDigiDetectCount();
+}
+
 extern "C" int countSIDs() __attribute__((noinline));
 extern "C" int EMSCRIPTEN_KEEPALIVE countSIDs() {
 	return SID::getNumberUsedChips();
@@ -819,6 +1277,56 @@ extern "C" const char** EMSCRIPTEN_KEEPALIVE getTraceStreams() {
 	return (const char**)_scope_buffers;	// ugly cast to make emscripten happy
 }
 
+// Turns the trace streams into rings of the specified capacity (in samples,
+// at least getMaxBlockLen()) that persist across blocks: each block is then written
+// directly after the previous one (wrapping at the end) and the host can read
+// the new data without any intermediate copies. 0 restores the default behavior, where
+// each block starts at the beginning of the streams. Takes effect with the
+// next playTune().
+extern "C" void setTraceRing(uint32_t capacity) __attribute__((noinline));
+extern "C" void EMSCRIPTEN_KEEPALIVE setTraceRing(uint32_t capacity) {
+	_trace_ring_cfg = capacity;	// see resetScopeBuffers()
+}
+
+// [0]: write index, i.e. the number of samples written to the trace rings so
+// far (the position in the rings is that modulo the capacity), [1]: capacity
+extern "C" uint32_t* getTraceRingInfo() __attribute__((noinline));
+extern "C" uint32_t* EMSCRIPTEN_KEEPALIVE getTraceRingInfo() {
+	return _trace_ring;
+}
+
+// Turns on the spectrum analysis of each rendered block: "size" is the used
+// FFT size (power of 2 in the 64..8192 range, 0 turns the analysis off) and
+// "per_voice" additionally analyzes each of the trace streams (see
+// getTraceStreams(), i.e. only while tracing is on). The analysis always
+// covers the last "size" samples, i.e. it may span several blocks. Also
+// invalidates the previous getSpectrum() pointer.
+extern "C" void setSpectrum(uint16_t size, uint8_t per_voice) __attribute__((noinline));
+extern "C" void EMSCRIPTEN_KEEPALIVE setSpectrum(uint16_t size, uint8_t per_voice) {
+	_spectrum_size = size;
+	_spectrum_voices = per_voice;
+	initSpectrum();
+}
+
+// Magnitudes calculated for the last block: "bins" floats per stream, stream 0
+// is the master output (mono mix of both channels) and stream 1+n corresponds
+// to trace stream n. Bin k covers the frequency k * getSampleRate() / size and
+// a full scale sine has a magnitude of 1.
+extern "C" float* getSpectrum() __attribute__((noinline));
+extern "C" float* EMSCRIPTEN_KEEPALIVE getSpectrum() {
+	return _spectrum.getBins();
+}
+
+// [0]: bins per stream, [1]: number of streams, [2]: FFT size (0 if off)
+extern "C" uint32_t* getSpectrumLayout() __attribute__((noinline));
+extern "C" uint32_t* EMSCRIPTEN_KEEPALIVE getSpectrumLayout() {
+	static uint32_t layout[3];
+	layout[0] = _spectrum.getSize() >> 1;
+	layout[1] = _spectrum.getStreams();
+	layout[2] = _spectrum.getSize();
+	return layout;
+}
+
 extern "C" int setFilterConfig6581(double base, double max, double steepness, double x_offset, double distort, double distort_offset, double distort_scale, double distort_threshold, double kink) __attribute__((noinline));
 extern "C" int EMSCRIPTEN_KEEPALIVE setFilterConfig6581(double base, double max, double steepness, double x_offset, double distort, double distort_offset, double distort_scale, double distort_threshold, double kink) {
 	return Filter6581::setFilterConfig6581(base, max, steepness, x_offset, distort, distort_offset, distort_scale, distort_threshold, kink);
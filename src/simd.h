@@ -0,0 +1,51 @@
+/*
+* Minimal SIMD support.
+*
+* Based on the GCC/clang "vector extensions" rather than on platform specific
+* intrinsics, i.e. the compiler maps the operations to SSE on x86, to NEON on
+* ARM and to WebAssembly SIMD128 (when built with -msimd128). On other
+* compilers a plain scalar implementation is used instead.
+*
+* WebSid (c) 2019 Jürgen Wothke
+* version 0.93
+*
+* Terms of Use: This software is licensed under a CC BY-NC-SA
+* (http://creativecommons.org/licenses/by-nc-sa/4.0/).
+*/
+#ifndef WEBSID_SIMD_H
+#define WEBSID_SIMD_H
+
+#if defined(__GNUC__) || defined(__clang__)
+#define USE_SIMD
+
+typedef float simd_float4 __attribute__((vector_size(16)));
+
+// for unaligned access to plain float arrays
+typedef float simd_float4_u __attribute__((vector_size(16), aligned(4), __may_alias__));
+#endif
+
+/**
+* Dot product of two float arrays.
+*
+* @param len must be a multiple of 4
+*/
+static inline float simdDotProduct(const float* a, const float* b, unsigned int len) {
+#ifdef USE_SIMD
+	simd_float4 acc = { 0.0f, 0.0f, 0.0f, 0.0f };
+	for (unsigned int i= 0; i<len; i+= 4) {
+		acc += *((const simd_float4_u*)(a + i)) * *((const simd_float4_u*)(b + i));
+	}
+	return (acc[0] + acc[1]) + (acc[2] + acc[3]);
+#else
+	float acc[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+	for (unsigned int i= 0; i<len; i+= 4) {
+		acc[0] += a[i] * b[i];
+		acc[1] += a[i + 1] * b[i + 1];
+		acc[2] += a[i + 2] * b[i + 2];
+		acc[3] += a[i + 3] * b[i + 3];
+	}
+	return (acc[0] + acc[1]) + (acc[2] + acc[3]);
+#endif
+}
+
+#endif
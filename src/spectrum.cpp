@@ -0,0 +1,263 @@
+/*
+* Spectrum analysis of the rendered output.
+*
+* WebSid (c) 2019 Jürgen Wothke
+* version 0.93
+*
+* Terms of Use: This software is licensed under a CC BY-NC-SA
+* (http://creativecommons.org/licenses/by-nc-sa/4.0/).
+*/
+
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "spectrum.h"
+#include "simd.h"
+
+Spectrum::Spectrum() {
+	_size = 0;
+	_streams = 0;
+
+	_history = _window = _tw_re = _tw_im = _split_re = _split_im = _work_re = _work_im = _bins = 0;
+	_pos = _bitrev = 0;
+}
+
+Spectrum::~Spectrum() {
+	freeBuffers();
+}
+
+void Spectrum::freeBuffers() {
+	free(_history);
+	free(_pos);
+	free(_window);
+	free(_bitrev);
+	free(_tw_re);
+	free(_tw_im);
+	free(_split_re);
+	free(_split_im);
+	free(_work_re);
+	free(_work_im);
+	free(_bins);
+
+	_history = _window = _tw_re = _tw_im = _split_re = _split_im = _work_re = _work_im = _bins = 0;
+	_pos = _bitrev = 0;
+}
+
+void Spectrum::configure(uint16_t size, uint8_t streams) {
+	freeBuffers();
+
+	if (!size || !streams) {
+		_size = 0;
+		_streams = 0;
+		return;
+	}
+	if (size < MIN_FFT_SIZE) size = MIN_FFT_SIZE;
+	if (size > MAX_FFT_SIZE) size = MAX_FFT_SIZE;
+
+	uint16_t s = MIN_FFT_SIZE;
+	while ((s << 1) <= size) s <<= 1;
+
+	_size = s;
+	_streams = streams;
+
+	const uint16_t n = _size >> 1;	// size of the complex FFT
+
+	_history = (float*)calloc((uint32_t)_streams * _size * 2, sizeof(float));
+	_pos = (uint16_t*)calloc(_streams, sizeof(uint16_t));
+	_bins = (float*)calloc((uint32_t)_streams * n, sizeof(float));
+
+	_window = (float*)malloc(_size * sizeof(float));
+	_bitrev = (uint16_t*)malloc(n * sizeof(uint16_t));
+	_tw_re = (float*)malloc(n * sizeof(float));
+	_tw_im = (float*)malloc(n * sizeof(float));
+	_split_re = (float*)malloc(n * sizeof(float));
+	_split_im = (float*)malloc(n * sizeof(float));
+	_work_re = (float*)malloc(n * sizeof(float));
+	_work_im = (float*)malloc(n * sizeof(float));
+
+	const double pi = 3.1415926535897932385;
+
+	// the window also compensates its coherent gain and the energy of the
+	// (not stored) negative frequencies
+	double sum = 0;
+	for (uint16_t i= 0; i<_size; i++) {
+		double w = 0.5 - 0.5 * cos(2.0 * pi * i / _size);	// Hann
+		_window[i] = (float)w;
+		sum += w;
+	}
+	for (uint16_t i= 0; i<_size; i++) {
+		_window[i] = (float)(_window[i] * 2.0 / sum);
+	}
+
+	uint8_t bits = 0;
+	while ((1 << bits) < n) bits++;
+
+	for (uint16_t i= 0; i<n; i++) {
+		uint16_t r = 0;
+		for (uint8_t b= 0; b<bits; b++) {
+			if (i & (1 << b)) r |= 1 << (bits - 1 - b);
+		}
+		_bitrev[i] = r;
+	}
+
+	_tw_re[0] = 1.0f;
+	_tw_im[0] = 0.0f;	// unused
+	for (uint16_t h= 1; h<n; h<<= 1) {
+		for (uint16_t k= 0; k<h; k++) {
+			double a = -pi * k / h;
+			_tw_re[h + k] = (float)cos(a);
+			_tw_im[h + k] = (float)sin(a);
+		}
+	}
+
+	for (uint16_t k= 0; k<n; k++) {
+		double a = -2.0 * pi * k / _size;
+		_split_re[k] = (float)cos(a);
+		_split_im[k] = (float)sin(a);
+	}
+}
+
+uint16_t Spectrum::getSize() {
+	return _size;
+}
+
+uint8_t Spectrum::getStreams() {
+	return _streams;
+}
+
+float* Spectrum::getBins() {
+	return _bins;
+}
+
+template <typename T>
+void Spectrum::feedHistory(uint8_t stream, const T* in, uint32_t step, uint32_t right, uint32_t len, float scale) {
+	if (stream >= _streams) return;
+
+	// only the last _size samples are relevant
+	if (len > _size) {
+		in += (len - _size) * step;
+		len = _size;
+	}
+
+	float* history = _history + (uint32_t)stream * _size * 2;
+	uint16_t pos = _pos[stream];
+
+	for (uint32_t i= 0; i<len; i++) {
+		float sample = ((float)in[0] + (float)in[right]) * scale;
+		in += step;
+
+		history[pos] = history[pos + _size] = sample;
+		if (++pos == _size) pos = 0;
+	}
+	_pos[stream] = pos;
+}
+
+void Spectrum::feed(uint8_t stream, const int16_t* in, uint32_t step, uint32_t right, uint32_t len) {
+	feedHistory(stream, in, step, right, len, 0.5f / 32768);
+}
+
+void Spectrum::feed(uint8_t stream, const float* in, uint32_t step, uint32_t right, uint32_t len) {
+	feedHistory(stream, in, step, right, len, 0.5f);
+}
+
+// in-place radix-2 FFT of size _size/2 (decimation in time)
+void Spectrum::fft(float* re, float* im) {
+	const uint16_t n = _size >> 1;
+
+	for (uint16_t i= 0; i<n; i++) {
+		uint16_t j = _bitrev[i];
+		if (i < j) {
+			float t = re[i]; re[i] = re[j]; re[j] = t;
+			t = im[i]; im[i] = im[j]; im[j] = t;
+		}
+	}
+
+	// spans 1 and 2 (i.e. one radix-4 pass) without any multiplications
+	for (uint16_t i= 0; i<n; i+= 4) {
+		float r0 = re[i] + re[i + 1],	i0 = im[i] + im[i + 1];
+		float r1 = re[i] - re[i + 1],	i1 = im[i] - im[i + 1];
+		float r2 = re[i + 2] + re[i + 3],	i2 = im[i + 2] + im[i + 3];
+		float r3 = re[i + 2] - re[i + 3],	i3 = im[i + 2] - im[i + 3];
+
+		// twiddle factor of index 1 is -i
+		re[i] = r0 + r2;		im[i] = i0 + i2;
+		re[i + 2] = r0 - r2;	im[i + 2] = i0 - i2;
+		re[i + 1] = r1 + i3;	im[i + 1] = i1 - r3;
+		re[i + 3] = r1 - i3;	im[i + 3] = i1 + r3;
+	}
+
+	for (uint16_t h= 4; h<n; h<<= 1) {
+		const float* tw_re = _tw_re + h;
+		const float* tw_im = _tw_im + h;
+
+		for (uint16_t start= 0; start<n; start+= h << 1) {
+			float* a_re = re + start;
+			float* a_im = im + start;
+			float* b_re = a_re + h;
+			float* b_im = a_im + h;
+
+#ifdef USE_SIMD
+			for (uint16_t k= 0; k<h; k+= 4) {
+				simd_float4 wr = *((const simd_float4_u*)(tw_re + k));
+				simd_float4 wi = *((const simd_float4_u*)(tw_im + k));
+				simd_float4 br = *((simd_float4_u*)(b_re + k));
+				simd_float4 bi = *((simd_float4_u*)(b_im + k));
+				simd_float4 ar = *((simd_float4_u*)(a_re + k));
+				simd_float4 ai = *((simd_float4_u*)(a_im + k));
+
+				simd_float4 tr = br * wr - bi * wi;
+				simd_float4 ti = br * wi + bi * wr;
+
+				*((simd_float4_u*)(a_re + k)) = ar + tr;
+				*((simd_float4_u*)(a_im + k)) = ai + ti;
+				*((simd_float4_u*)(b_re + k)) = ar - tr;
+				*((simd_float4_u*)(b_im + k)) = ai - ti;
+			}
+#else
+			for (uint16_t k= 0; k<h; k++) {
+				float tr = b_re[k] * tw_re[k] - b_im[k] * tw_im[k];
+				float ti = b_re[k] * tw_im[k] + b_im[k] * tw_re[k];
+
+				b_re[k] = a_re[k] - tr;
+				b_im[k] = a_im[k] - ti;
+				a_re[k] += tr;
+				a_im[k] += ti;
+			}
+#endif
+		}
+	}
+}
+
+void Spectrum::analyze() {
+	const uint16_t n = _size >> 1;
+
+	for (uint8_t stream= 0; stream<_streams; stream++) {
+		const float* x = _history + (uint32_t)stream * _size * 2 + _pos[stream];
+
+		for (uint16_t i= 0; i<n; i++) {
+			_work_re[i] = x[2 * i] * _window[2 * i];
+			_work_im[i] = x[2 * i + 1] * _window[2 * i + 1];
+		}
+		fft(_work_re, _work_im);
+
+		// split the spectra of the even (real part) and odd (imaginary
+		// part) samples and combine them to the spectrum of the input
+		float* bins = _bins + (uint32_t)stream * n;
+
+		for (uint16_t k= 0; k<n; k++) {
+			uint16_t m = k ? n - k : 0;
+
+			float ar = _work_re[k], ai = _work_im[k];
+			float br = _work_re[m], bi = _work_im[m];
+
+			float er = 0.5f * (ar + br),	ei = 0.5f * (ai - bi);
+			float or_ = 0.5f * (ai + bi),	oi = 0.5f * (br - ar);
+
+			float xr = er + _split_re[k] * or_ - _split_im[k] * oi;
+			float xi = ei + _split_re[k] * oi + _split_im[k] * or_;
+
+			bins[k] = sqrtf(xr * xr + xi * xi);
+		}
+	}
+}
@@ -0,0 +1,94 @@
+/*
+* Spectrum analysis of the rendered output.
+*
+* Visualizations typically want to show the frequency spectrum of the master
+* output and/or of the individual voices. This class keeps the most recent
+* input samples of each analyzed stream and calculates the magnitudes of
+* their spectrum once per rendered block, using a Hann windowed real FFT.
+*
+* The real FFT of size N is calculated via a complex FFT of size N/2 (even
+* samples as the real part, odd samples as the imaginary part), which is then
+* split into the spectrum of the real input.
+*
+* WebSid (c) 2019 Jürgen Wothke
+* version 0.93
+*
+* Terms of Use: This software is licensed under a CC BY-NC-SA
+* (http://creativecommons.org/licenses/by-nc-sa/4.0/).
+*/
+#ifndef WEBSID_SPECTRUM_H
+#define WEBSID_SPECTRUM_H
+
+extern "C" {
+#include "base.h"
+}
+
+#define MIN_FFT_SIZE 64
+#define MAX_FFT_SIZE 8192
+
+class Spectrum {
+public:
+	Spectrum();
+	~Spectrum();
+
+	/**
+	* Sets up the analysis and clears the history.
+	*
+	* @param size FFT size, i.e. a power of 2 in the MIN_FFT_SIZE..MAX_FFT_SIZE
+	*             range (other values are rounded down) or 0 to turn the
+	*             analysis off
+	* @param streams number of separately analyzed input streams
+	*/
+	void configure(uint16_t size, uint8_t streams);
+
+	uint16_t getSize();
+	uint8_t getStreams();
+
+	/**
+	* Appends "len" mono input samples to the history of the specified stream.
+	* Each sample is the average of in[i*step] and in[i*step + right], i.e.
+	* "right" is 0 for a mono input. int16 input is scaled to the -1..1 range.
+	*/
+	void feed(uint8_t stream, const int16_t* in, uint32_t step, uint32_t right, uint32_t len);
+	void feed(uint8_t stream, const float* in, uint32_t step, uint32_t right, uint32_t len);
+
+	/**
+	* Calculates the spectrum of the last "size" samples of each stream.
+	*/
+	void analyze();
+
+	/**
+	* Gets the result of the last analyze(): size/2 magnitude bins per stream
+	* (stored one stream after the other). Bin k covers the frequency
+	* k * sample_rate / size and a full scale sine yields a magnitude of 1.
+	*/
+	float* getBins();
+
+private:
+	template <typename T>
+	void		feedHistory(uint8_t stream, const T* in, uint32_t step, uint32_t right, uint32_t len, float scale);
+
+	void		fft(float* re, float* im);
+	void		freeBuffers();
+
+	uint16_t	_size;
+	uint8_t		_streams;
+
+	// the history of each stream is stored twice in succession so that the
+	// last _size input samples are always available as one contiguous array
+	float*		_history;
+	uint16_t*	_pos;			// per stream: index of the oldest history sample
+
+	float*		_window;		// Hann window (incl. normalization of the magnitudes)
+	uint16_t*	_bitrev;		// bit reversed indices of the complex FFT
+	float*		_tw_re;			// twiddle factors of the complex FFT: the ones
+	float*		_tw_im;			// used for butterflies of span h start at index h
+	float*		_split_re;		// twiddle factors used to split the real spectrum
+	float*		_split_im;
+	float*		_work_re;
+	float*		_work_im;
+
+	float*		_bins;
+};
+
+#endif
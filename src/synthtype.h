@@ -0,0 +1,117 @@
+/*
+* Numeric types used by the synthesis.
+*
+* The filters, the external filter and the waveform generation are implemented
+* against the types/helpers defined here so that the used arithmetic can be
+* selected at compile time:
+*
+*  - by default "double" is used, i.e. this is the reference implementation
+*  - SYNTH_FLOAT switches everything to "float", which is significantly faster
+*    on ARM and WebAssembly and which halves the size of the respective state
+*  - SYNTH_FIXED switches the filter state to fixed-point integers (signals with
+*    SYNTH_FRAC_BITS fractional bits and Q16 coefficients), the waveform
+*    generation then uses "float"
+*
+* The deviation of the alternative backends from the "double" reference can be
+* measured using tools/synthcompare.
+*
+* WebSid (c) 2019 Jürgen Wothke
+* version 0.93
+*
+* Terms of Use: This software is licensed under a CC BY-NC-SA
+* (http://creativecommons.org/licenses/by-nc-sa/4.0/).
+*/
+#ifndef WEBSID_SYNTHTYPE_H
+#define WEBSID_SYNTHTYPE_H
+
+extern "C" {
+#include "base.h"
+}
+#include "simd.h"
+
+// select one of the alternative backends (or use the respective -D compiler switch)
+//#define SYNTH_FLOAT
+//#define SYNTH_FIXED
+
+#if !defined(SYNTH_FLOAT) && !defined(SYNTH_FIXED)
+#define SYNTH_DOUBLE
+#endif
+
+
+#ifdef SYNTH_FIXED
+
+#define SYNTH_FRAC_BITS 8		// fractional bits of the signal
+#define SYNTH_COEFF_BITS 16		// fractional bits of the coefficients
+
+typedef int32_t synth_t;		// signal/filter state
+typedef int32_t synth_coeff_t;	// filter coefficients
+typedef float synth_real_t;		// waveform generation
+
+static inline synth_t synthFromInt(int32_t v) {
+	return v * (1 << SYNTH_FRAC_BITS);
+}
+
+static inline int32_t synthToInt(synth_t v) {
+	return v / (1 << SYNTH_FRAC_BITS);	// truncated like the float to int conversion
+}
+
+static inline float synthToFloat(synth_t v) {
+	return v * (1.0f / (1 << SYNTH_FRAC_BITS));
+}
+
+static inline double synthToDouble(synth_t v) {
+	return v * (1.0 / (1 << SYNTH_FRAC_BITS));
+}
+
+static inline synth_coeff_t synthCoeff(double c) {
+	return (synth_coeff_t)(c * (1 << SYNTH_COEFF_BITS) + (c < 0 ? -0.5 : 0.5));
+}
+
+static inline synth_t synthMul(synth_t v, synth_coeff_t c) {
+	// rounded: truncation would cause a DC drift in the filter feedback loops
+	return (synth_t)(((long long)v * c + (1 << (SYNTH_COEFF_BITS - 1))) >> SYNTH_COEFF_BITS);
+}
+
+#else
+
+#ifdef SYNTH_FLOAT
+typedef float synth_t;
+#else
+typedef double synth_t;
+#endif
+typedef synth_t synth_coeff_t;
+typedef synth_t synth_real_t;
+
+static inline synth_t synthFromInt(int32_t v) {
+	return (synth_t)v;
+}
+
+static inline int32_t synthToInt(synth_t v) {
+	return (int32_t)v;
+}
+
+static inline float synthToFloat(synth_t v) {
+	return (float)v;
+}
+
+static inline double synthToDouble(synth_t v) {
+	return v;
+}
+
+static inline synth_coeff_t synthCoeff(double c) {
+	return (synth_coeff_t)c;
+}
+
+static inline synth_t synthMul(synth_t v, synth_coeff_t c) {
+	return v * c;
+}
+
+#ifdef USE_SIMD
+// 4 lanes of synth_t, e.g. used to process the 3 voices of a SID in parallel
+#define USE_SYNTH_VEC
+typedef synth_t synth_vec __attribute__((vector_size(4 * sizeof(synth_t))));
+#endif
+
+#endif
+
+#endif
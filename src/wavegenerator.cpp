@@ -27,6 +27,7 @@ extern "C" {
 #include "system.h"		// SYS_CYCLES()
 }
 #include "wavegenerator.h"
+#include "combinedwaveforms.h"	// precalculated combined waveforms
 
 // waveform control register flags
 	// other flags
@@ -46,49 +47,6 @@ extern "C" {
 const double SCALE_12_16 = ((double)0xffff) / 0xfff;
 #endif
 
-/**
-* This utility class keeps the precalculated "combined waveform" lookup tables.
-*
-* There is no point keeping these in each SID instance (since they are the same anyway)
-*/
-class WaveformTables {
-public:
-	WaveformTables();
-private:
-	static void createCombinedWF(double* wfarray, double bitmul, double bitstrength, double threshold);
-public:
-	// Hermit's precalculated "combined waveforms"
-	double TriSaw_8580[4096];
-	double PulseSaw_8580[4096];
-	double PulseTri_8580[4096];			// Hermit's use of PulseSaw_8580 does not convince in Last_Ninja
-	double PulseTriSaw_8580[4096];
-};
-
-WaveformTables::WaveformTables() {
-    createCombinedWF(TriSaw_8580, 		0.8, 2.4, 0.64);
-    createCombinedWF(PulseSaw_8580, 	1.4, 1.9, 0.68);
-	createCombinedWF(PulseTriSaw_8580, 	0.8, 2.5, 0.64);
-	// far from "correct" but at least a bit better than Hermit's use of PulseSaw_8580 (see Last_Ninja)
-    createCombinedWF(PulseTri_8580, 	0.8, 1.5, 0.38);	// improved settings are welcome!
-}
-
-void WaveformTables::createCombinedWF(double* wfarray, double bitmul, double bitstrength, double threshold) {
-	// Hermit: "I found out how the combined waveform works (neighboring bits affect each other recursively)"
-	for (uint16_t i = 0; i < 4096; i++) {
-		wfarray[i] = 0; //neighbour-bit strength and DAC MOSFET threshold is approximately set by ears'n'trials
-		for (uint8_t j = 0; j < 12; j++) {
-			double bitlevel = 0;
-			for (uint8_t k = 0; k < 12; k++) {
-				bitlevel += (bitmul / pow(bitstrength, abs(k - j))) * (((i >> k) & 1) - 0.5);
-			}
-			wfarray[i] += (bitlevel >= threshold) ? pow(2.0, (double)j) : 0;
-		}
-		wfarray[i] *= 12;
-	}
-}
-
-static WaveformTables _wave_table;		// only need one instance of this
-
 
 // ----------------------- utils -----------------------------
 
@@ -310,6 +268,126 @@ void WaveGenerator::shiftNoiseRegisterNoTestBit() {
 	activateNoiseOutput();				// extract current _noiseout signal
 }
 
+// ---------------------------------------------------------------------------------------------
+// ------ noise LFSR jump-ahead                                                        ----------
+// ---------------------------------------------------------------------------------------------
+
+// The regular shifting of the noise register is linear over GF(2), i.e. N shifts
+// correspond to a multiplication with the N-th power of the 23x23 bit "shift matrix".
+// The powers M^(2^i) are precalculated so that any N can be handled with at most 23
+// matrix multiplications (the register's period is 2^23-1).
+
+#define NOISE_BITS 23
+#define NOISE_MASK ((((uint32_t)1) << NOISE_BITS) - 1)	// also the period
+
+static bool _noise_jump_ready = false;
+static uint32_t _noise_jump_tbl[NOISE_BITS][NOISE_BITS];	// [i]: columns of M^(2^i)
+
+static uint32_t mulNoiseMatrix(const uint32_t* cols, uint32_t v) {
+	uint32_t result = 0;
+	for (uint8_t i= 0; v; i++, v >>= 1) {
+		if (v & 1) result ^= cols[i];
+	}
+	return result;
+}
+
+static void initNoiseJumpTable() {
+	for (uint8_t i= 0; i<NOISE_BITS; i++) {
+		// see shiftNoiseRegisterNoTestBit()
+		uint32_t feed = ((i == 22) || (i == 17)) ? 1 : 0;
+		_noise_jump_tbl[0][i] = ((((uint32_t)1) << (i + 1)) & NOISE_MASK) | feed;
+	}
+	for (uint8_t p= 1; p<NOISE_BITS; p++) {
+		for (uint8_t i= 0; i<NOISE_BITS; i++) {
+			_noise_jump_tbl[p][i] = mulNoiseMatrix(_noise_jump_tbl[p - 1], _noise_jump_tbl[p - 1][i]);
+		}
+	}
+	_noise_jump_ready = true;
+}
+
+uint32_t WaveGenerator::jumpNoiseRegister(uint32_t lfsr, uint32_t shifts) {
+	if (!_noise_jump_ready) initNoiseJumpTable();
+
+	// note: the excess bits above bit 22 are never used (see shiftNoiseRegisterNoTestBit())
+	lfsr &= NOISE_MASK;
+	shifts %= NOISE_MASK;
+
+	for (uint8_t p= 0; shifts; p++, shifts >>= 1) {
+		if (shifts & 1) lfsr = mulNoiseMatrix(_noise_jump_tbl[p], lfsr);
+	}
+	return lfsr;
+}
+
+void WaveGenerator::shiftNoiseRegisterAt(uint32_t ts) {
+	// same as shiftNoiseRegisterNoTestBit() for a shift that happened in the past
+	// (shifts before the current sample interval do not contribute to its output)
+	if ((int32_t)(ts - _ref1_ts) > 0) {
+		_noiseout_sum += (ts - _ref1_ts) * _noiseout;
+		_ref1_ts = ts;
+	}
+
+	uint32_t feed = (GET_BIT(_noise_LFSR, 22) ^ GET_BIT(_noise_LFSR, 17));
+	_noise_LFSR = ((_noise_LFSR << 1) | feed);
+
+	activateNoiseOutput();
+}
+
+void WaveGenerator::fastForwardNoise(uint32_t start_counter, uint32_t cycles, uint32_t end_ts) {
+	// same result as the CLOCK_NOISE_GENERATOR() of the respective number of
+	// clockPhase1() calls: a rising edge of bit 19 shifts the register 2 cycles
+	// later (such edges are at least 16 cycles apart so the respective delays
+	// never overlap). cycle j (1..cycles) of the span has timestamp
+	// end_ts - (cycles - j)
+
+	if (_trigger_noise_shift) {
+		// shift that was already scheduled before the span
+		if (_trigger_noise_shift > cycles) {
+			_trigger_noise_shift -= cycles;
+			return;
+		}
+		shiftNoiseRegisterAt(end_ts - (cycles - _trigger_noise_shift));
+		_trigger_noise_shift = 0;
+	}
+	if (!_freq) return;
+
+	// distance to the first rising edge of bit 19
+	const double edge_dist = 0x100000;
+	double d = (0x80000 - (start_counter & 0xfffff)) & 0xfffff;
+	if (d == 0) d = edge_dist;
+
+	double total = ((double)cycles) * _freq;
+	if (total < d) return;
+
+	uint32_t edges = (uint32_t)floor((total - d) / edge_dist) + 1;
+
+	// the last edge may not have been followed by its shift yet
+	uint32_t last_edge = (uint32_t)ceil((d + (edges - 1) * edge_dist) / _freq);
+	uint32_t shifts = edges;
+	if (last_edge + 2 > cycles) {
+		_trigger_noise_shift = last_edge + 2 - cycles;
+		shifts--;
+	}
+	if (!shifts) return;
+
+	// shifts before the current sample interval do not contribute to the
+	// noise oversampling and they can therefore be skipped in bulk
+	int32_t passed = (int32_t)(end_ts - _ref1_ts);	// cycles since the start of the interval
+	int32_t limit = (int32_t)cycles - passed - 2;	// edges up to this cycle are done by then
+	uint32_t skipped = 0;
+	if ((limit > 0) && (((double)limit) * _freq >= d)) {
+		skipped = (uint32_t)floor((((double)limit) * _freq - d) / edge_dist) + 1;
+		if (skipped > shifts) skipped = shifts;
+	}
+	if (skipped) {
+		_noise_LFSR = jumpNoiseRegister(_noise_LFSR, skipped);
+		activateNoiseOutput();
+	}
+	for (uint32_t i= skipped; i<shifts; i++) {
+		uint32_t edge = (uint32_t)ceil((d + i * edge_dist) / _freq);
+		shiftNoiseRegisterAt(end_ts - (cycles - edge - 2));
+	}
+}
+
 void WaveGenerator::shiftNoiseRegisterTestBitDriven(const uint8_t new_ctrl) {
 	// shifting triggered by high->low transition of the test-bit, i.e. triggered via
 	// a bus-access from the CPU (i.e. during the the 1st half of the clock-cycle - while
@@ -357,7 +435,10 @@ uint16_t WaveGenerator::noiseOutput() {
 
 	_noiseout_sum += (SYS_CYCLES() - _ref1_ts) * (uint32_t)_noiseout; // fill remainder of the sample interval
 
-	uint16_t result = _noiseout_sum / (SYS_CYCLES() - _ref0_ts);
+	// the interval may be empty when used from setWave() in the same cycle
+	// that the last sample was completed (likely with oversampling)
+	uint32_t cycles = SYS_CYCLES() - _ref0_ts;
+	uint16_t result = cycles ? _noiseout_sum / cycles : _noiseout;
 	SAMPLE_END();
 	return result;
 }
@@ -412,7 +493,7 @@ uint16_t WaveGenerator::createSawOutput() {	// test-case: Super_Huey.sid (2 saw
 	// based on cycle-by-cycle oversampling: Hermit makes the curve steeper than it should be and his anti-aliasing
 	// at the discuntinuity is then also quite off (as compared to the oversampled curve).
 
-	double wfout = _counter >> 8;	// top 16-bits (actual saw output valid at this exatc clock cycle)
+	synth_real_t wfout = _counter >> 8;	// top 16-bits (actual saw output valid at this exatc clock cycle)
 	wfout += wfout * _freq_saw_step;	// Hermit uses a lookahead scheme! i.e. his output is off by 22 cycles/1 sample..
 	if (wfout > 0xffff) {
 		wfout = 0xffff - (wfout - 0x10000) / _freq_saw_step;	// with _freq_saw_step=0 it should never get in here
@@ -425,7 +506,7 @@ uint16_t WaveGenerator::createSawOutput() {	// test-case: Super_Huey.sid (2 saw
 		// of the previous sawtooth (i.e. the reset of the saw signal occured within this sample).. interpolate
 		// the respective parts to avoid aliasing effects
 
-		double prop_down = _counter * _freq_inc_sample_inv; 	// proportion after reset
+		synth_real_t prop_down = _counter * _freq_inc_sample_inv; 	// proportion after reset
 
 		// the range that does not require interpolation is [_saw_sample_step/2 to 0xffff-_saw_sample_step/2],
 		// i.e. the available interpolation range is 0xffff-_saw_sample_step and the correct base would be
@@ -483,7 +564,7 @@ uint16_t WaveGenerator::createPulseOutput(uint32_t tmp, uint32_t pw) {	// elemen
 //	double step = ((double)256.0) / (v->freq_inc_sample / (1<<16));	// Hermit's original shift-impl was prone to division-by-zero
 
 	// simple pulse, most often used waveform, make it sound as clean as possible without oversampling
-	double lim;
+	synth_real_t lim;
 	int32_t wfout;
 	if (tmp < pw) {	// rising edge (i.e. 0x0 side)	(in scope this is: TOP)
 		lim = (0xffff - pw) * _freq_pulse_step;
@@ -539,10 +620,10 @@ uint16_t WaveGenerator::createPulseOutput() {
 			// _counter reflects the freq increments that have already been
 			// applied so far:
 			uint32_t np = _counter / _freq;		// number of clocks spent in the new pulse
-			double op = _cycles_per_sample - np;// number of clocks spent in the old pulse
+			synth_real_t op = _cycles_per_sample - np;// number of clocks spent in the old pulse
 
 			// how many clocks can the PULSE be HIGH with the current FREQ?
-			double highc = _pulse_width12_neg / _freq;
+			synth_real_t highc = _pulse_width12_neg / _freq;
 			if (highc > op) highc = op;
 
 			return highc * _ffff_cycles_per_sample_inv;
@@ -554,7 +635,7 @@ uint16_t WaveGenerator::createPulseOutput() {
 			// (testcase: _freq = 0xffff;_pulse_width = 0xff;)
 
 			uint32_t lowc = _pulse_width12 / _freq;
-			double highc = _cycles_per_sample - lowc;
+			synth_real_t highc = _cycles_per_sample - lowc;
 
 			return highc * _ffff_cycles_per_sample_inv;
 		}
@@ -566,7 +647,7 @@ uint16_t WaveGenerator::createPulseOutput() {
 	// signal was already low during the previous sample)
 	else if ((_counter > _pulse_width12) && (_counter  < _pulse_width12_plus)) {
 
-		double highc = (_counter - _pulse_width12) / _freq;
+		synth_real_t highc = (_counter - _pulse_width12) / _freq;
 		return highc * _ffff_cycles_per_sample_inv;
 	}
 
@@ -593,7 +674,7 @@ uint16_t WaveGenerator::pulseOutput() {
 // ---------------------------------------------------------------------------------------------
 uint16_t WaveGenerator::triangleSawOutput() {
 	// TRIANGLE & SAW - like in Garden_Party.sid
-	uint16_t o = combinedWF(_wave_table.TriSaw_8580, _counter >> 12, 1);			// 12 MSB needed
+	uint16_t o = combinedWF(TriSaw_8580, _counter >> 12, 1);			// 12 MSB needed
 	SAMPLE_END();
 	return o;
 }
@@ -615,7 +696,7 @@ uint16_t WaveGenerator::pulseTriangleOutput() {
 	// sound has none of the crispness nor volume of the original
 
 	uint32_t c = GET_RINGMOD_COUNTER();
-	uint16_t o =  plsout ? combinedWF(_wave_table.PulseTri_8580, (c ^ (c & 0x800000 ? 0xffffff : 0)) >> 11, 0) : 0;	// either on or off
+	uint16_t o =  plsout ? combinedWF(PulseTri_8580, (c ^ (c & 0x800000 ? 0xffffff : 0)) >> 11, 0) : 0;	// either on or off
 
 	SAMPLE_END();
 	return o;
@@ -628,11 +709,11 @@ uint16_t WaveGenerator::pulseTriangleSawOutput() {
 	uint32_t tmp, pw;	// 16 bits used
 	calcPulseBase(&tmp, &pw);
 	plsout =  ((tmp >= pw) || _test_bit) ? 0xffff : 0; //(this would be enough for simple but aliased-at-high-pitches pulse)
-	uint16_t o =  plsout ? combinedWF(_wave_table.PulseTriSaw_8580, tmp >> 4, 1) : 0;	// tmp 12 MSB
+	uint16_t o =  plsout ? combinedWF(PulseTriSaw_8580, tmp >> 4, 1) : 0;	// tmp 12 MSB
 #else
 //	plsout = createPulseOutput();	// plain should be good enough
 	plsout =  ((_counter >> 12 >= _pulse_width) || _test_bit) ? 0xffff : 0;
-	uint16_t o =  plsout ? combinedWF(_wave_table.PulseTriSaw_8580, _counter >> 12, 1) : 0;	// 12 MSB needed
+	uint16_t o =  plsout ? combinedWF(PulseTriSaw_8580, _counter >> 12, 1) : 0;	// 12 MSB needed
 #endif
 	SAMPLE_END();
 	return o;
@@ -645,21 +726,130 @@ uint16_t WaveGenerator::pulseSawOutput() {
 	uint32_t tmp, pw;	// 16 bits used
 	calcPulseBase(&tmp, &pw);
 	plsout =  ((tmp >= pw) || _test_bit) ? 0xffff : 0; //(this would be enough for simple but aliased-at-high-pitches pulse)
-	uint16_t o =   plsout ? combinedWF(_wave_table.PulseSaw_8580, tmp >> 4, 1) : 0;	// tmp 12 MSB
+	uint16_t o =   plsout ? combinedWF(PulseSaw_8580, tmp >> 4, 1) : 0;	// tmp 12 MSB
 #else
 //	plsout = createPulseOutput();	// plain should be good enough
 	plsout =  ((_counter >> 12 >= _pulse_width) || _test_bit) ? 0xffff : 0;
-	uint16_t o =   plsout ? combinedWF(_wave_table.PulseSaw_8580, _counter >> 12, 1) : 0;	// 12 MSB needed
+	uint16_t o =   plsout ? combinedWF(PulseSaw_8580, _counter >> 12, 1) : 0;	// 12 MSB needed
 #endif
 	SAMPLE_END();
 	return o;
 }
 
+// ---------------------------------------------------------------------------------------------
+// ------ band-limited waveforms (see WaveGenerator::setBandLimited())                ----------
+// ---------------------------------------------------------------------------------------------
+
+// The naive waveforms contain hard steps (saw reset, pulse edges) that may fall anywhere
+// within a sample-interval, i.e. they alias. The PolyBLEP approach adds a 2-sample polynomial
+// residual around each step (one sample before and one after) which approximates the
+// difference between the naive and a band-limited step. The required "position" of a step
+// is directly derived from the accumulator, i.e. from _freq and _pulse_width.
+
+#define PHASE_SCALE ((synth_real_t)1.0 / 0x1000000)	// 24-bit accumulator to [0, 1)
+
+static bool _band_limited = false;
+
+void WaveGenerator::setBandLimited(bool on) {
+	_band_limited = on;
+}
+
+// residual of a unit step at phase 0, for the sample at phase "t" (dt: phase increment per sample)
+static inline synth_real_t polyBLEP(synth_real_t t, synth_real_t dt) {
+	if (t < dt) {
+		t /= dt;
+		return t + t - t * t - 1.0f;
+	} else if (t > 1.0f - dt) {
+		t = (t - 1.0f) / dt;
+		return t * t + t + t + 1.0f;
+	}
+	return 0.0f;
+}
+
+static inline uint16_t clip16(synth_real_t o) {
+	if (o < 0) return 0;
+	if (o > 0xffff) return 0xffff;
+	return (uint16_t)o;
+}
+
+// residuals of the pulse edges: rising at the pulse-width, falling at the accumulator wrap
+synth_real_t WaveGenerator::pulseEdgeBLEP(synth_real_t rise_height, synth_real_t fall_height) {
+	synth_real_t rise = polyBLEP(((_counter - _pulse_width12) & 0xffffff) * PHASE_SCALE, _blep_dt);
+	synth_real_t fall = polyBLEP(_counter * PHASE_SCALE, _blep_dt);
+	return (rise_height * rise - fall_height * fall) * 0.5f;
+}
+
+synth_real_t WaveGenerator::combinedLevel(const uint16_t* wfarray, uint16_t index, uint8_t differ6581) {
+	if (differ6581 && _sid->_is_6581) index &= 0x7ff;
+	return wfarray[index];
+}
+
+uint16_t WaveGenerator::sawOutputBL() {
+	synth_real_t o = (_counter >> 8) - 0x8000 * polyBLEP(_counter * PHASE_SCALE, _blep_dt);
+	SAMPLE_END();
+	return clip16(o);
+}
+
+uint16_t WaveGenerator::pulseOutputBL() {
+	if (_test_bit) {
+		SAMPLE_END();
+		return 0xffff;
+	}
+	synth_real_t o = (_counter < _pulse_width12 ? 0 : 0xffff) + pulseEdgeBLEP(0xffff, 0xffff);
+	SAMPLE_END();
+	return clip16(o);
+}
+
+uint16_t WaveGenerator::triangleSawOutputBL() {
+	synth_real_t o = triangleSawOutput();
+
+	// note: the combined output only steps at the saw reset
+	synth_real_t blep = polyBLEP(_counter * PHASE_SCALE, _blep_dt);
+	if (blep != 0) {
+		synth_real_t top = combinedLevel(TriSaw_8580, 0xfff, 1);
+		synth_real_t bottom = combinedLevel(TriSaw_8580, 0, 1);
+		o -= (top - bottom) * 0.5f * blep;
+	}
+	return clip16(o);
+}
+
+uint16_t WaveGenerator::pulseTriangleOutputBL() {
+	synth_real_t o = pulseTriangleOutput();
+	if (!_test_bit) {
+		// note: the ring modulation is ignored for the step heights
+		uint32_t pw = _pulse_width12 ^ (_pulse_width12 & 0x800000 ? 0xffffff : 0);
+		synth_real_t rise = combinedLevel(PulseTri_8580, pw >> 11, 0);
+		synth_real_t fall = combinedLevel(PulseTri_8580, 0, 0);
+		o += pulseEdgeBLEP(rise, fall);
+	}
+	return clip16(o);
+}
+
+uint16_t WaveGenerator::pulseTriangleSawOutputBL() {
+	synth_real_t o = pulseTriangleSawOutput();
+	if (!_test_bit) {
+		synth_real_t rise = combinedLevel(PulseTriSaw_8580, _pulse_width, 1);
+		synth_real_t fall = combinedLevel(PulseTriSaw_8580, 0xfff, 1);
+		o += pulseEdgeBLEP(rise, fall);
+	}
+	return clip16(o);
+}
+
+uint16_t WaveGenerator::pulseSawOutputBL() {
+	synth_real_t o = pulseSawOutput();
+	if (!_test_bit) {
+		synth_real_t rise = combinedLevel(PulseSaw_8580, _pulse_width, 1);
+		synth_real_t fall = combinedLevel(PulseSaw_8580, 0xfff, 1);
+		o += pulseEdgeBLEP(rise, fall);
+	}
+	return clip16(o);
+}
+
 // Hermit's impl to calculate combined waveforms (check his jsSID-0.9.1-tech_comments
 // in commented jsSID.js for background info): I did not thoroughly check how well
 // this really works (it works well enough for Kentilla and Clique_Baby (apparently
 // this one has to sound as shitty as it does)
-uint16_t WaveGenerator::combinedWF(double* wfarray, uint16_t index, uint8_t differ6581) {
+uint16_t WaveGenerator::combinedWF(const uint16_t* wfarray, uint16_t index, uint8_t differ6581) {
 	//on 6581 most combined waveforms are essentially halved 8580-like waves
 
 	if (differ6581 && _sid->_is_6581) index &= 0x7ff;	// todo: add getter for _sid var or replicate into WaveGenerator
@@ -670,7 +860,7 @@ uint16_t WaveGenerator::combinedWF(double* wfarray, uint16_t index, uint8_t diff
 	*/
 
 	// optimization?
-	uint32_t combiwf = ((uint32_t)(wfarray[index] + _prev_wav_data)) >> 1;	// missing rounding might not make much of a difference
+	uint32_t combiwf = ((uint32_t)wfarray[index] + _prev_wav_data) >> 1;	// missing rounding might not make much of a difference
 	_prev_wav_data = wfarray[index];
 	return (uint16_t)combiwf;
 }
@@ -690,10 +880,10 @@ uint16_t WaveGenerator::combinedWF(double* wfarray, uint16_t index, uint8_t diff
 			getOutput = &WaveGenerator::triangleOutput;\
 			break;\
 		case SAW_BITMASK:\
-			getOutput = &WaveGenerator::sawOutput;\
+			getOutput = _band_limited ? &WaveGenerator::sawOutputBL : &WaveGenerator::sawOutput;\
 			break;\
 		case PULSE_BITMASK:\
-			getOutput = &WaveGenerator::pulseOutput;\
+			getOutput = _band_limited ? &WaveGenerator::pulseOutputBL : &WaveGenerator::pulseOutput;\
 			break;\
 		case NOISE_BITMASK:\
 			getOutput = &WaveGenerator::noiseOutput;\
@@ -701,16 +891,16 @@ uint16_t WaveGenerator::combinedWF(double* wfarray, uint16_t index, uint8_t diff
 					\
 		/* commonly used combined waveforms */\
 		case TRI_BITMASK|SAW_BITMASK:\
-			getOutput = &WaveGenerator::triangleSawOutput;\
+			getOutput = _band_limited ? &WaveGenerator::triangleSawOutputBL : &WaveGenerator::triangleSawOutput;\
 			break;\
 		case PULSE_BITMASK|TRI_BITMASK:\
-			getOutput = &WaveGenerator::pulseTriangleOutput;\
+			getOutput = _band_limited ? &WaveGenerator::pulseTriangleOutputBL : &WaveGenerator::pulseTriangleOutput;\
 			break;\
 		case PULSE_BITMASK|TRI_BITMASK|SAW_BITMASK:\
-			getOutput = &WaveGenerator::pulseTriangleSawOutput;\
+			getOutput = _band_limited ? &WaveGenerator::pulseTriangleSawOutputBL : &WaveGenerator::pulseTriangleSawOutput;\
 			break;\
 		case PULSE_BITMASK|SAW_BITMASK:\
-			getOutput = &WaveGenerator::pulseSawOutput;\
+			getOutput = _band_limited ? &WaveGenerator::pulseSawOutputBL : &WaveGenerator::pulseSawOutput;\
 			break;\
 					\
 		default:\
@@ -718,6 +908,10 @@ uint16_t WaveGenerator::combinedWF(double* wfarray, uint16_t index, uint8_t diff
 			break;\
 	}
 
+void WaveGenerator::updateOutputFunc() {
+	SET_OUTPUT_FUNC(_wf_bits);
+}
+
 uint8_t	WaveGenerator::getOsc() {
 	// What is sometimes incorrectly referred to as the "value of the oscillator" is indeed
 	// the top 8 bits of the  waveform output. For practical purposes combined WFs seem to
@@ -773,7 +967,8 @@ void WaveGenerator::reset(double cycles_per_sample) {
 	activateNoiseOutput(); // init _noiseout
 
 
-	_freq_inc_sample = _prev_wav_data = 0;
+	_freq_inc_sample = _blep_dt = _prev_wav_data = 0;
+	_caches_dirty = false;
 
 	setMute(0);
 
@@ -797,6 +992,8 @@ void WaveGenerator::setWave(const uint8_t new_ctrl) {
 
 	const uint8_t new_wf_bits = new_ctrl & WF_BITMASK;
 
+	syncCaches();	// the current output may be needed below
+
 	if (_wf_bits && (new_wf_bits == 0)) {
 		// when WF selector is set to 0, the output enters into a "floating mode"
 		// (see "docs/floating-waveform.txt" for details)
@@ -837,7 +1034,7 @@ void WaveGenerator::setPulseWidthLow(const uint8_t val) {
 	// 16 MSB pulse needed (input is 12-bit)
 	_pulse_out = (uint32_t)(_pulse_width * SCALE_12_16);
 #else
-	updatePulseCache();
+	_caches_dirty = true;
 #endif
 }
 
@@ -849,14 +1046,16 @@ void WaveGenerator::setPulseWidthHigh(const uint8_t val) {
 	// 16 MSB pulse needed (input is 12-bit)
 	_pulse_out = (uint32_t)(_pulse_width * SCALE_12_16);
 #else
-	updatePulseCache();
+	_caches_dirty = true;
 #endif
 }
 
 
 void WaveGenerator::updateFreqCache() {
+	_caches_dirty = false;
 
 	_freq_inc_sample = _cycles_per_sample * _freq;	// per 1-sample interval (e.g. ~22 cycles)
+	_blep_dt = _freq_inc_sample * PHASE_SCALE;
 #ifndef USE_HERMIT_ANTIALIAS
 	_freq_inc_sample_inv = 1.0 / _freq_inc_sample; 	// use faster multiplications later
 	_ffff_freq_inc_sample_inv = ((double)0xffff) / _freq_inc_sample;
@@ -883,12 +1082,12 @@ void WaveGenerator::updateFreqCache() {
 
 void WaveGenerator::setFreqLow(const uint8_t val) {
 	_freq = (_freq & 0xff00) | val;
-	updateFreqCache();	// perf opt
+	_caches_dirty = true;	// perf opt: FM digis write this thousands of times per second
 }
 
 void WaveGenerator::setFreqHigh(const uint8_t val) {
 	_freq = (_freq & 0xff) | (val << 8);
-	updateFreqCache();	// perf opt
+	_caches_dirty = true;
 }
 
 uint8_t WaveGenerator::getWave() {
@@ -926,6 +1125,48 @@ void WaveGenerator::clockPhase1() {
 	}
 }
 
+bool WaveGenerator::isDeferrable() {
+	// the clocking can be deferred (see fastForward()) as long as it does
+	// nothing but increment the oscillator and shift the noise register: the
+	// test-bit and the feedback of combined noise waveforms depend on the exact
+	// cycle, and hard-sync needs both involved oscillators to be clocked together
+	WaveGenerator *dest_voice = _sid->getWaveGenerator(NEXT_IDX(_voice_idx));
+
+	return !(_test_bit | _sync_bit | dest_voice->_sync_bit) &&
+			(!_noise_bit || (_wf_bits == NOISE_BITMASK));
+}
+
+bool WaveGenerator::isSleepable() {
+	// in addition to isDeferrable(), a sleeping voice's oscillator must not be
+	// used by the next voice (ring) and combined waveforms (see _prev_wav_data)
+	// must not be skipped either.
+
+	WaveGenerator *dest_voice = _sid->getWaveGenerator(NEXT_IDX(_voice_idx));
+
+	return isDeferrable() && !dest_voice->_ring_bit &&
+			!(_wf_bits & (_wf_bits - 1));	// max one WF selected
+}
+
+void WaveGenerator::fastForward(uint32_t cycles, uint32_t end_ts) {
+	// same result as the respective number of clockPhase1() calls for
+	// an isDeferrable() voice
+	if (cycles) {
+		uint32_t start_counter = _counter;
+		uint32_t prev_counter = (_counter + (cycles - 1) * _freq) & 0xffffff;
+		_counter = (prev_counter + _freq) & 0xffffff;
+
+		_msb_rising = (_counter & 0x800000) > (prev_counter & 0x800000);
+
+		if (_noise_bit) fastForwardNoise(start_counter, cycles, end_ts);
+	}
+}
+
+void WaveGenerator::skipSample() {
+	// a voice that is known to not contribute to the output still
+	// needs to keep its sample interval in sync
+	SAMPLE_END();
+}
+
 void WaveGenerator::clockPhase2() {
 	// sync the oscillators: "hard sync" is accomplished by clearing the accumulator
 	// of an oscillator based on the accumulator MSB of the previous oscillator.
@@ -11,6 +11,7 @@
 #define WEBSID_VOICE_H
 
 #include "base.h"
+#include "synthtype.h"
 
 
 // Hermit's impls are quite a bit off as compared to respective oversampled
@@ -21,6 +22,7 @@
 class WaveGenerator {
 protected:
 	friend class SID;								// the only user of Voice
+	friend class NoiseTest;							// see tools/noisetest
 
 	WaveGenerator(class SID* sid, uint8_t voice_idx);
 
@@ -30,6 +32,12 @@ protected:
 	void		clockPhase1();
 	void		clockPhase2();
 
+	// support for "sleeping"/deferred voices (see SID::clock())
+	bool		isDeferrable();
+	bool		isSleepable();
+	void		fastForward(uint32_t cycles, uint32_t end_ts);
+	void		skipSample();
+
 	void		setMute(uint8_t is_muted);
 	uint8_t		isMuted();
 
@@ -46,13 +54,23 @@ protected:
 	uint16_t	getFreq();
 
 	// waveform generation
+	/**
+	* Must be called before getOutput: the frequency/pulse width derived
+	* caches are only updated here (i.e. at most once per sample rather than
+	* on each register write).
+	*/
+	inline void	syncCaches() { if (_caches_dirty) updateFreqCache(); }
 	uint16_t	(WaveGenerator::*getOutput)();	// try to save additional wrapper by using pointer directly..
 	uint8_t		getOsc();
 
+	// use band-limited (PolyBLEP) saw & pulse based waveforms (see SID::setBandLimitedWaveforms())
+	static void	setBandLimited(bool on);
+	void		updateOutputFunc();
+
 private:
 	// utils for waveform generation
 	void		updateFreqCache();
-	uint16_t	combinedWF(double* wfarray, uint16_t index, uint8_t differ6581);
+	uint16_t	combinedWF(const uint16_t* wfarray, uint16_t index, uint8_t differ6581);
 	uint16_t	createTriangleOutput();
 	uint16_t	createSawOutput();
 
@@ -69,6 +87,11 @@ private:
 	void 		shiftNoiseRegisterNoTestBit();
 	void 		shiftNoiseRegisterTestBitDriven(const uint8_t new_ctrl);
 
+	// advancing the noise register in bulk (see fastForward())
+	static uint32_t jumpNoiseRegister(uint32_t lfsr, uint32_t shifts);
+	void		shiftNoiseRegisterAt(uint32_t ts);
+	void		fastForwardNoise(uint32_t start_counter, uint32_t cycles, uint32_t end_ts);
+
 	void 		feedbackNoise(uint16_t out);
 		// "shift register refill" feature
 	void		resetNoiseGenerator();
@@ -89,21 +112,26 @@ private:
 
 	uint16_t pulseTriangleSawOutput();
 
-private:
-	class SID*	_sid;
-	uint8_t		_voice_idx;
-	double		_cycles_per_sample;
+		// band-limited variants
+	synth_real_t	pulseEdgeBLEP(synth_real_t rise_height, synth_real_t fall_height);
+	synth_real_t	combinedLevel(const uint16_t* wfarray, uint16_t index, uint8_t differ6581);
 
+	uint16_t sawOutputBL();
+	uint16_t pulseOutputBL();
+	uint16_t triangleSawOutputBL();
+	uint16_t pulseTriangleOutputBL();
+	uint16_t pulseSawOutputBL();
+	uint16_t pulseTriangleSawOutputBL();
 
-	uint8_t		_is_muted;			// player's separate "mute" feature
+private:
+	// note: members are ordered by access frequency: the fields used on every
+	// cycle come first so that they share the same cache line(s)
 
-	// base oscillator state
+	// base oscillator state (hot: clocked every cycle)
     uint32_t	_counter;			// aka "accumulator" (24-bit)
 	uint16_t	_freq;				// counter increment per cycle
 	uint8_t		_msb_rising;		// hard sync handling
 
-	// waveform generation
-    uint8_t		_ctrl;				// waveform control register
 		// performance opt: redundant flags from _ctrl (at their original position)
 	uint8_t		_wf_bits;
 	uint8_t		_test_bit;
@@ -111,7 +139,20 @@ private:
 	uint8_t		_ring_bit;
 	uint8_t		_noise_bit;
 
-	double		_freq_inc_sample;
+		// noise waveform
+    uint32_t	_noise_LFSR;
+	uint32_t	_trigger_noise_shift;
+    uint32_t	_noise_reset_ts;
+			// sub-sample noise handling/resampling
+    uint16_t	_noiseout;		// last wave output
+	uint32_t	_ref0_ts;		// start of the current sample interval
+	uint32_t	_ref1_ts;		// already handled part of the current sample interval
+    uint32_t	_noiseout_sum;	// summed up noise used for interpolation
+
+	// waveform generation (warm: used once per sample)
+	synth_real_t		_freq_inc_sample;
+	synth_real_t		_blep_dt;			// phase increment per sample
+	bool		_caches_dirty;		// frequency or pulse width changed since the last updateFreqCache()
 
 		// pulse waveform
 	uint16_t	_pulse_width;		// 12-bit "pulse width" from respective SID registers
@@ -119,14 +160,14 @@ private:
 #ifdef USE_HERMIT_ANTIALIAS
 	uint32_t	_pulse_out;			// 16-bit "pulse width" _pulse_width<<4 shifted for convenience)
 	uint32_t	_freq_pulse_base;
-	double		_freq_pulse_step;
+	synth_real_t		_freq_pulse_step;
 
 		// saw waveform
-	double		_freq_saw_step;
+	synth_real_t		_freq_saw_step;
 #else
-	double		_freq_inc_sample_inv;
-	double		_ffff_freq_inc_sample_inv;
-	double		_ffff_cycles_per_sample_inv;
+	synth_real_t		_freq_inc_sample_inv;
+	synth_real_t		_ffff_freq_inc_sample_inv;
+	synth_real_t		_ffff_cycles_per_sample_inv;
 	uint32_t	_pulse_width12_neg;
 	uint32_t	_pulse_width12_plus;
 
@@ -135,24 +176,20 @@ private:
 	uint32_t	_saw_base;
 #endif
 
-		// noise waveform
-    uint32_t	_noise_LFSR;
-	uint32_t	_trigger_noise_shift;
-    uint32_t	_noise_reset_ts;
-			// sub-sample noise handling/resampling
-    uint16_t	_noiseout;		// last wave output
-	uint32_t	_ref0_ts;		// start of the current sample interval
-	uint32_t	_ref1_ts;		// already handled part of the current sample interval
-    uint32_t	_noiseout_sum;	// summed up noise used for interpolation
-
-
-
 	// add-ons snatched from Hermit's implementation
-	double		_prev_wav_data;		// combined waveform handling
+	uint16_t	_prev_wav_data;		// combined waveform handling
 
 	// floating wavegen
 	uint16_t 	_floating_null_wf;
 	uint32_t 	_floating_null_ts;
+
+	// cold: configuration and register mirrors
+    uint8_t		_ctrl;				// waveform control register
+	uint8_t		_is_muted;			// player's separate "mute" feature
+
+	class SID*	_sid;
+	uint8_t		_voice_idx;
+	synth_real_t		_cycles_per_sample;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,164 @@
+/*
+* Randomized differential test of the envelope generator's fast path.
+*
+* Envelope::advance() must leave the envelope in exactly the same state as
+* the respective number of clockEnvelope() calls. Each trial starts two
+* envelopes from the same random state and then runs a couple of random
+* spans (mostly short, some of them spanning many LFSR periods) with one
+* envelope clocked cycle by cycle and the other one advanced in one go. In
+* between the spans the same random AD/SR writes and gate changes are
+* applied to both. The complete EnvelopeState is compared after each span.
+*
+* usage: envtest <trials> [<seed>]
+*
+* WebSid (c) 2019 Jürgen Wothke
+* version 0.93
+*
+* Terms of Use: This software is licensed under a CC BY-NC-SA
+* (http://creativecommons.org/licenses/by-nc-sa/4.0/).
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "envelope.h"
+
+#define MAX_SPANS 8
+
+// same as the EnvelopePhase in envelope.cpp
+#define ATTACK 0
+#define RELEASE 3
+
+static const char* _phase_names[] = { "attack", "decay", "sustain", "release" };
+
+class EnvelopeTest {
+public:
+	EnvelopeTest() : _cycled(0, 0), _advanced(0, 0), _cycles(0) {}
+
+	bool run(uint32_t trial);
+
+	double getCycles() { return _cycles; }
+private:
+	void randomize();
+	void randomWrite();
+	bool runSpan(uint32_t trial, uint32_t span);
+	void dump(const char* name, EnvelopeState* s);
+
+	Envelope _cycled;	// reference: clockEnvelope()
+	Envelope _advanced;	// advance()
+	double _cycles;
+};
+
+void EnvelopeTest::randomize() {
+	_cycled.poke(0x5, rand() & 0xff);	// also sets the cached thresholds
+	_cycled.poke(0x6, rand() & 0xff);
+
+	EnvelopeState* s = &_cycled._state;
+	s->envphase = rand() & 0x3;
+
+	switch (rand() & 0x3) {	// bias towards the interesting levels
+		case 0:
+			s->envelope_output = 0;
+			break;
+		case 1:
+			s->envelope_output = 0xff;
+			break;
+		case 2:
+			s->envelope_output = s->sustain;
+			break;
+		default:
+			s->envelope_output = rand() & 0xff;
+			break;
+	}
+	s->zero_lock = s->envelope_output ? 0 : rand() & 0x1;
+	s->current_LFSR = rand() & 0x7fff;
+	s->exponential_counter = rand() % 30;
+
+	_advanced._state = *s;
+}
+
+void EnvelopeTest::randomWrite() {
+	// the same writes are applied to both envelopes (a gate change is done
+	// directly since poke() would need the owning SID)
+	switch (rand() % 3) {
+		case 0: {
+			uint8_t val = rand() & 0xff;
+			_cycled.poke(0x5, val);
+			_advanced.poke(0x5, val);
+			break;
+		}
+		case 1: {
+			uint8_t val = rand() & 0xff;
+			_cycled.poke(0x6, val);
+			_advanced.poke(0x6, val);
+			break;
+		}
+		default: {
+			EnvelopeState* s = &_cycled._state;
+			if (s->envphase == RELEASE) {
+				s->envphase = ATTACK;
+				s->zero_lock = 0;
+			} else {
+				s->envphase = RELEASE;
+			}
+			_advanced._state = *s;
+			break;
+		}
+	}
+}
+
+void EnvelopeTest::dump(const char* name, EnvelopeState* s) {
+	fprintf(stderr, "  %-13s: phase=%s output=%d LFSR=%d exp_counter=%d zero_lock=%d\n", name,
+			_phase_names[s->envphase], s->envelope_output, s->current_LFSR,
+			s->exponential_counter, s->zero_lock);
+}
+
+bool EnvelopeTest::runSpan(uint32_t trial, uint32_t span) {
+	EnvelopeState start = _cycled._state;
+
+	uint32_t cycles = (rand() & 0x7) ? rand() % 20000 : rand() % 400000;
+	for (uint32_t i= 0; i<cycles; i++) {
+		_cycled.clockEnvelope();
+	}
+	_advanced.advance(cycles);
+	_cycles += cycles;
+
+	if (memcmp(&_cycled._state, &_advanced._state, sizeof(EnvelopeState))) {
+		fprintf(stderr, "error: trial %u, span %u: mismatch after %u cycles (AD=$%02x SR=$%02x)\n",
+				trial, span, cycles, start.ad, start.sr);
+		dump("start", &start);
+		dump("clockEnvelope", &_cycled._state);
+		dump("advance", &_advanced._state);
+		return false;
+	}
+	return true;
+}
+
+bool EnvelopeTest::run(uint32_t trial) {
+	randomize();
+
+	uint32_t spans = 1 + rand() % MAX_SPANS;
+	for (uint32_t i= 0; i<spans; i++) {
+		if (i) randomWrite();
+		if (!runSpan(trial, i)) return false;
+	}
+	return true;
+}
+
+int main(int argc, char** argv) {
+	if (argc < 2) {
+		fprintf(stderr, "usage: %s <trials> [<seed>]\n", argv[0]);
+		return 1;
+	}
+	uint32_t trials = atoi(argv[1]);
+	uint32_t seed = (argc > 2) ? atoi(argv[2]) : 1;
+	srand(seed);
+
+	EnvelopeTest test;
+	for (uint32_t i= 0; i<trials; i++) {
+		if (!test.run(i)) return 1;
+	}
+	printf("envelope: %u trials (seed %u), %.0f cycles: ok\n", trials, seed, test.getCycles());
+	return 0;
+}
@@ -0,0 +1,118 @@
+/*
+* Measures the cost of the 6581 filter configuration and how much of the
+* distortion table (see Filter6581) is actually used by a song.
+*
+* setFilterConfig6581() is timed first and compared to the calculation of the
+* complete CUTOFF_SIZE x DIST_LEVELS table (i.e. what the configuration used
+* to cost before the table was built lazily). Then each music file is played
+* and the number of table rows that were built while it played is reported.
+*
+* usage: filterbench <seconds> <music file>...
+*
+* WebSid (c) 2019 Jürgen Wothke
+* version 0.93
+*
+* Terms of Use: This software is licensed under a CC BY-NC-SA
+* (http://creativecommons.org/licenses/by-nc-sa/4.0/).
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "filter6581.h"
+
+#define SAMPLE_RATE 44100
+#define MAX_FILE_SIZE 0x20000
+#define REPEAT 200
+
+// see sidplayer.cpp
+extern "C" uint32_t loadSidFile(uint32_t is_mus, void* in_buffer, uint32_t in_buf_size,
+								uint32_t sample_rate, char* filename, void* basic_ROM,
+								void* char_ROM, void* kernal_ROM);
+extern "C" uint32_t playTune(uint32_t selected_track, uint32_t trace_sid, uint32_t procBufSize);
+extern "C" int32_t computeAudioSamples();
+extern "C" uint32_t getSoundBufferLen();
+extern "C" uint8_t envIsSID6581();
+
+static uint8_t _file_buffer[MAX_FILE_SIZE];
+
+static double now() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+}
+
+// re-applies the current configuration, i.e. invalidates all the table rows
+static void reconfigure() {
+	double* c = Filter6581::getFilterConfig6581();
+	Filter6581::setFilterConfig6581(c[0], c[1], c[2], c[3], c[4], c[5], c[6], c[7], c[8]);
+}
+
+static void benchConfig() {
+	Filter6581::getCutoff6581(0);	// make sure the filter is initialized
+
+	double t = now();
+	for (int i= 0; i<REPEAT; i++) {
+		reconfigure();
+	}
+	double config_ms = (now() - t) / REPEAT;
+
+	// the same calculations as the complete table
+	t = now();
+	for (int i= 0; i<DIST_LEVELS; i++) {
+		Filter6581::getCutoff6581(i);
+	}
+	double table_ms = now() - t;
+
+	printf("setFilterConfig6581(): %.3f ms, complete table: %.3f ms (%d KB)\n", config_ms, table_ms,
+			(int)(CUTOFF_SIZE * DIST_LEVELS * sizeof(float) / 1024));
+}
+
+static void benchFile(char* filename, uint32_t seconds) {
+	FILE* in = fopen(filename, "rb");
+	if (!in) {
+		fprintf(stderr, "error: cannot open %s\n", filename);
+		return;
+	}
+	uint32_t size = fread(_file_buffer, 1, MAX_FILE_SIZE, in);
+	fclose(in);
+
+	if (loadSidFile(0, _file_buffer, size, SAMPLE_RATE, filename, 0, 0, 0)) {
+		fprintf(stderr, "error: cannot load %s\n", filename);
+		return;
+	}
+	playTune(0, 0, 8192);
+
+	if (!envIsSID6581()) {
+		printf("%s: 8580 (no distortion table)\n", filename);
+		return;
+	}
+	reconfigure();
+
+	double t = now();
+	uint32_t remaining = seconds * SAMPLE_RATE;
+	while (remaining) {
+		if (computeAudioSamples() < 0) break;
+
+		uint32_t len = getSoundBufferLen();
+		remaining -= len > remaining ? remaining : len;
+	}
+	int rows = Filter6581::getDistortionRowCount();
+
+	printf("%s: %d of %d rows built (%d KB), %.1f ms\n", filename, rows, CUTOFF_SIZE,
+			(int)(rows * DIST_LEVELS * sizeof(float) / 1024), now() - t);
+}
+
+int main(int argc, char** argv) {
+	if (argc < 2) {
+		fprintf(stderr, "usage: %s <seconds> <music file>...\n", argv[0]);
+		return 1;
+	}
+	benchConfig();
+
+	for (int i= 2; i<argc; i++) {
+		benchFile(argv[i], atoi(argv[1]));
+	}
+	return 0;
+}
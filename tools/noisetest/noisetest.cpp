@@ -0,0 +1,222 @@
+/*
+* Randomized differential test of the noise generator's fast path.
+*
+* WaveGenerator::jumpNoiseRegister() must give the same register content as
+* the respective number of single shifts: random registers are jumped by a
+* random number of shifts (some trials use counts beyond the register's
+* period of 2^23-1) and compared against plain shifting.
+*
+* WaveGenerator::fastForward() must leave a deferrable noise voice in exactly
+* the same state as the respective number of clockPhase1() calls. Each trial
+* starts two voices from the same random state and then runs a couple of
+* random spans with one voice clocked cycle by cycle and the other one
+* forwarded in one go. A new sample interval is started at a random cycle of
+* each span (which is where the oversampled noise output is summed up from).
+* In between the spans the same random frequency is set on both voices.
+*
+* usage: noisetest <trials> [<seed>]
+*
+* WebSid (c) 2019 Jürgen Wothke
+* version 0.93
+*
+* Terms of Use: This software is licensed under a CC BY-NC-SA
+* (http://creativecommons.org/licenses/by-nc-sa/4.0/).
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+extern "C" {
+#include "system.h"		// _cycles is set directly to control SYS_CYCLES()
+}
+#include "wavegenerator.h"
+
+#define MAX_SPANS 8
+
+// same as in wavegenerator.cpp
+#define NOISE_BITMASK 0x80
+#define NOISE_MASK 0x7fffff		// 23-bit register (also the period)
+
+static uint32_t rand32() {
+	return (((uint32_t)rand()) << 16) ^ ((uint32_t)rand());
+}
+
+static uint32_t shiftNoise(uint32_t lfsr, uint32_t shifts) {
+	// see WaveGenerator::shiftNoiseRegisterNoTestBit()
+	for (uint32_t i= 0; i<shifts; i++) {
+		uint32_t feed = ((lfsr >> 22) ^ (lfsr >> 17)) & 0x1;
+		lfsr = (lfsr << 1) | feed;
+	}
+	return lfsr & NOISE_MASK;
+}
+
+class NoiseTest {
+public:
+	NoiseTest() : _cycled(0, 0), _forwarded(0, 0), _shifts(0), _clocked(0) {}
+
+	bool runJump(uint32_t trial);
+	bool run(uint32_t trial);
+
+	double getShifts() { return _shifts; }
+	double getCycles() { return _clocked; }
+private:
+	void randomize();
+	void sampleEnd(WaveGenerator* w, uint32_t ts);
+	bool runSpan(uint32_t trial, uint32_t span);
+	void dump(const char* name, WaveGenerator* w);
+
+	WaveGenerator _cycled;		// reference: clockPhase1()
+	WaveGenerator _forwarded;	// fastForward()
+	double _shifts;
+	double _clocked;
+};
+
+bool NoiseTest::runJump(uint32_t trial) {
+	uint32_t lfsr;
+	switch (trial & 0x3) {
+		case 0:
+			lfsr = NOISE_MASK;	// the reset state (see refillNoiseShiftRegister())
+			break;
+		case 1:
+			lfsr = (trial & 0x4) ? 0 : 1;
+			break;
+		default:
+			lfsr = rand32();	// including excess bits which must be ignored
+			break;
+	}
+
+	uint32_t shifts;
+	if (trial % 500 == 0) {
+		// beyond the period: the count is only relevant modulo 2^23-1
+		shifts = NOISE_MASK + (trial ? rand32() % (3 * NOISE_MASK) : 0);
+	} else {
+		shifts = (rand() & 0x7) ? rand() % 5000 : rand32() % 0x100000;
+	}
+
+	uint32_t expected = shiftNoise(lfsr, shifts);
+	uint32_t jumped = WaveGenerator::jumpNoiseRegister(lfsr, shifts);
+	_shifts += shifts;
+
+	if (jumped != expected) {
+		fprintf(stderr, "error: trial %u: jump mismatch for $%06x after %u shifts: $%06x (expected $%06x)\n",
+				trial, lfsr, shifts, jumped, expected);
+		return false;
+	}
+	return true;
+}
+
+void NoiseTest::sampleEnd(WaveGenerator* w, uint32_t ts) {
+	// see SAMPLE_END() in wavegenerator.cpp
+	w->_ref0_ts = w->_ref1_ts = ts;
+	w->_noiseout_sum = 0;
+}
+
+void NoiseTest::randomize() {
+	_cycled.reset(22.3);
+
+	// a deferrable voice (see isDeferrable()): plain noise
+	_cycled._ctrl = _cycled._wf_bits = _cycled._noise_bit = NOISE_BITMASK;
+
+	switch (rand() & 0x3) {	// bias towards the extremes
+		case 0:
+			_cycled._freq = (rand() & 0x1) ? 0 : 0xffff;
+			break;
+		case 1:
+			_cycled._freq = rand() & 0xf;
+			break;
+		default:
+			_cycled._freq = rand() & 0xffff;
+			break;
+	}
+	_cycled._counter = rand32() & 0xffffff;
+	_cycled._noise_LFSR = rand32() & NOISE_MASK;
+	_cycled.activateNoiseOutput();
+
+	// the state must be consistent, e.g. a pending shift must result from
+	// an actual edge: clock the reference for a while to get there
+	_cycles = rand32();
+	sampleEnd(&_cycled, _cycles);
+
+	uint32_t warmup = rand() % 64;
+	for (uint32_t i= 0; i<warmup; i++) {
+		_cycles++;
+		_cycled.clockPhase1();
+	}
+	_forwarded = _cycled;
+}
+
+void NoiseTest::dump(const char* name, WaveGenerator* w) {
+	fprintf(stderr, "  %-11s: counter=$%06x msb_rising=%d LFSR=$%06x trigger=%u noiseout=$%04x sum=%u ref1=%u\n", name,
+			w->_counter, w->_msb_rising, w->_noise_LFSR & NOISE_MASK, w->_trigger_noise_shift,
+			w->_noiseout, w->_noiseout_sum, w->_ref1_ts);
+}
+
+bool NoiseTest::runSpan(uint32_t trial, uint32_t span) {
+	uint32_t start = _cycles;
+	uint32_t start_counter = _cycled._counter;
+
+	uint32_t cycles = (rand() & 0x7) ? rand() % 2000 : rand() % 400000;
+	uint32_t interval = start + ((rand() & 0x3) ? rand() % (cycles + 1) : 0);	// start of the current sample
+
+	if (interval == start) sampleEnd(&_cycled, start);
+	for (uint32_t i= 1; i<=cycles; i++) {
+		_cycles = start + i;
+		_cycled.clockPhase1();
+
+		if (_cycles == interval) sampleEnd(&_cycled, interval);
+	}
+
+	sampleEnd(&_forwarded, interval);
+	_forwarded.fastForward(cycles, _cycles);
+	_clocked += cycles;
+
+	if (((_cycled._counter != _forwarded._counter)) ||
+			(_cycled._msb_rising != _forwarded._msb_rising) ||
+			((_cycled._noise_LFSR ^ _forwarded._noise_LFSR) & NOISE_MASK) ||
+			(_cycled._trigger_noise_shift != _forwarded._trigger_noise_shift) ||
+			(_cycled._noiseout != _forwarded._noiseout) ||
+			(_cycled._noiseout_sum != _forwarded._noiseout_sum) ||
+			(_cycled._ref1_ts != _forwarded._ref1_ts)) {
+		fprintf(stderr, "error: trial %u, span %u: mismatch after %u cycles (freq=$%04x counter=$%06x, interval at +%u)\n",
+				trial, span, cycles, _cycled._freq, start_counter, interval - start);
+		dump("clockPhase1", &_cycled);
+		dump("fastForward", &_forwarded);
+		return false;
+	}
+	return true;
+}
+
+bool NoiseTest::run(uint32_t trial) {
+	randomize();
+
+	uint32_t spans = 1 + rand() % MAX_SPANS;
+	for (uint32_t i= 0; i<spans; i++) {
+		if (i) {
+			_cycled._freq = _forwarded._freq = rand() & 0xffff;
+		}
+		if (!runSpan(trial, i)) return false;
+	}
+	return true;
+}
+
+int main(int argc, char** argv) {
+	if (argc < 2) {
+		fprintf(stderr, "usage: %s <trials> [<seed>]\n", argv[0]);
+		return 1;
+	}
+	uint32_t trials = atoi(argv[1]);
+	uint32_t seed = (argc > 2) ? atoi(argv[2]) : 1;
+	srand(seed);
+
+	NoiseTest test;
+	for (uint32_t i= 0; i<trials; i++) {
+		if (!test.runJump(i)) return 1;
+	}
+	printf("noise jump: %u trials (seed %u), %.0f shifts: ok\n", trials, seed, test.getShifts());
+
+	for (uint32_t i= 0; i<trials; i++) {
+		if (!test.run(i)) return 1;
+	}
+	printf("noise fast forward: %u trials (seed %u), %.0f cycles: ok\n", trials, seed, test.getCycles());
+	return 0;
+}
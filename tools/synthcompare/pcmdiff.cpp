@@ -0,0 +1,65 @@
+/*
+* Reports the deviation of a raw audio file (16-bit samples) from a reference.
+*
+* usage: pcmdiff <reference file> <file> [label]
+*
+* WebSid (c) 2019 Jürgen Wothke
+* version 0.93
+*
+* Terms of Use: This software is licensed under a CC BY-NC-SA
+* (http://creativecommons.org/licenses/by-nc-sa/4.0/).
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#define BLOCK_SIZE 4096
+
+int main(int argc, char** argv) {
+	if (argc < 3) {
+		fprintf(stderr, "usage: %s <reference file> <file> [label]\n", argv[0]);
+		return 1;
+	}
+
+	FILE* ref = fopen(argv[1], "rb");
+	FILE* in = fopen(argv[2], "rb");
+	if (!ref || !in) {
+		fprintf(stderr, "error: cannot open input files\n");
+		return 1;
+	}
+
+	short ref_buf[BLOCK_SIZE];
+	short buf[BLOCK_SIZE];
+
+	unsigned long count = 0;
+	int max_dev = 0;
+	double sum_sq = 0, ref_sum_sq = 0;
+
+	for (;;) {
+		size_t n = fread(ref_buf, sizeof(short), BLOCK_SIZE, ref);
+		size_t m = fread(buf, sizeof(short), BLOCK_SIZE, in);
+		if (m < n) n = m;
+		if (!n) break;
+
+		for (size_t i= 0; i<n; i++) {
+			int d = abs(buf[i] - ref_buf[i]);
+			if (d > max_dev) max_dev = d;
+
+			sum_sq += (double)d * d;
+			ref_sum_sq += (double)ref_buf[i] * ref_buf[i];
+		}
+		count += n;
+	}
+	fclose(ref);
+	fclose(in);
+
+	double rms = count ? sqrt(sum_sq / count) : 0;
+	double ref_rms = count ? sqrt(ref_sum_sq / count) : 0;
+
+	// signal-to-deviation ratio relative to the reference's level
+	double snr = (rms > 0 && ref_rms > 0) ? 20.0 * log10(ref_rms / rms) : INFINITY;
+
+	printf("%-40s max: %5d  rms: %9.3f  snr: %6.1f dB\n", argc > 3 ? argv[3] : argv[2], max_dev, rms, snr);
+	return 0;
+}
@@ -0,0 +1,75 @@
+/*
+* Renders a music file into a raw audio file (interleaved 16-bit stereo).
+*
+* Used to compare the output of the different synthesis backends (see
+* synthtype.h), i.e. this same program is built once per backend.
+*
+* usage: render <music file> <seconds> <output file>
+*
+* WebSid (c) 2019 Jürgen Wothke
+* version 0.93
+*
+* Terms of Use: This software is licensed under a CC BY-NC-SA
+* (http://creativecommons.org/licenses/by-nc-sa/4.0/).
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+extern "C" {
+#include "base.h"
+}
+
+#define SAMPLE_RATE 44100
+#define MAX_FILE_SIZE 0x20000
+
+// see sidplayer.cpp
+extern "C" uint32_t loadSidFile(uint32_t is_mus, void* in_buffer, uint32_t in_buf_size,
+								uint32_t sample_rate, char* filename, void* basic_ROM,
+								void* char_ROM, void* kernal_ROM);
+extern "C" uint32_t playTune(uint32_t selected_track, uint32_t trace_sid, uint32_t procBufSize);
+extern "C" int32_t computeAudioSamples();
+extern "C" char* getSoundBuffer();
+extern "C" uint32_t getSoundBufferLen();
+
+static uint8_t _file_buffer[MAX_FILE_SIZE];
+
+int main(int argc, char** argv) {
+	if (argc < 4) {
+		fprintf(stderr, "usage: %s <music file> <seconds> <output file>\n", argv[0]);
+		return 1;
+	}
+
+	FILE* in = fopen(argv[1], "rb");
+	if (!in) {
+		fprintf(stderr, "error: cannot open %s\n", argv[1]);
+		return 1;
+	}
+	uint32_t size = fread(_file_buffer, 1, MAX_FILE_SIZE, in);
+	fclose(in);
+
+	if (loadSidFile(0, _file_buffer, size, SAMPLE_RATE, argv[1], 0, 0, 0)) {
+		fprintf(stderr, "error: cannot load %s\n", argv[1]);
+		return 1;
+	}
+	playTune(0, 0, 8192);
+
+	FILE* out = fopen(argv[3], "wb");
+	if (!out) {
+		fprintf(stderr, "error: cannot create %s\n", argv[3]);
+		return 1;
+	}
+
+	uint32_t remaining = atoi(argv[2]) * SAMPLE_RATE;
+	while (remaining) {
+		if (computeAudioSamples() < 0) break;
+
+		uint32_t len = getSoundBufferLen();
+		if (len > remaining) len = remaining;
+
+		fwrite(getSoundBuffer(), 4, len, out);	// 2 channels, 16-bit each
+		remaining -= len;
+	}
+	fclose(out);
+	return 0;
+}
@@ -0,0 +1,111 @@
+/*
+* Measures the cost of SID register writes.
+*
+* Each music file is first played for one second (so that the digi detection
+* is in the state that the song puts it into) and then pairs of SID registers
+* are written directly via setRegisterSID(), alternating between the two
+* registers of each pair. The average time per write is reported, i.e. the
+* emulation itself is not clocked during the measurement.
+*
+* usage: writebench <writes> <music file>...
+*
+* WebSid (c) 2019 Jürgen Wothke
+* version 0.93
+*
+* Terms of Use: This software is licensed under a CC BY-NC-SA
+* (http://creativecommons.org/licenses/by-nc-sa/4.0/).
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+extern "C" {
+#include "base.h"
+}
+
+#define SAMPLE_RATE 44100
+#define MAX_FILE_SIZE 0x20000
+
+// see sidplayer.cpp
+extern "C" uint32_t loadSidFile(uint32_t is_mus, void* in_buffer, uint32_t in_buf_size,
+								uint32_t sample_rate, char* filename, void* basic_ROM,
+								void* char_ROM, void* kernal_ROM);
+extern "C" uint32_t playTune(uint32_t selected_track, uint32_t trace_sid, uint32_t procBufSize);
+extern "C" int32_t computeAudioSamples();
+extern "C" uint32_t getSoundBufferLen();
+extern "C" void setRegisterSID(uint16_t reg, uint8_t value);
+extern "C" const char* getDigiTypeDesc();
+extern "C" uint16_t getDigiRate();
+
+struct RegPair {
+	const char* name;
+	uint16_t	reg0;
+	uint16_t	reg1;
+};
+
+static const RegPair _pairs[] = {
+	{ "freq    $D400/$D401", 0x00, 0x01 },
+	{ "pulse   $D402/$D403", 0x02, 0x03 },
+	{ "ctrl/AD $D404/$D405", 0x04, 0x05 },
+	{ "cutoff  $D415/$D416", 0x15, 0x16 },
+	{ "res/vol $D417/$D418", 0x17, 0x18 },
+};
+
+static uint8_t _file_buffer[MAX_FILE_SIZE];
+
+static double now() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void benchFile(char* filename, uint32_t writes) {
+	FILE* in = fopen(filename, "rb");
+	if (!in) {
+		fprintf(stderr, "error: cannot open %s\n", filename);
+		return;
+	}
+	uint32_t size = fread(_file_buffer, 1, MAX_FILE_SIZE, in);
+	fclose(in);
+
+	if (loadSidFile(0, _file_buffer, size, SAMPLE_RATE, filename, 0, 0, 0)) {
+		fprintf(stderr, "error: cannot load %s\n", filename);
+		return;
+	}
+	playTune(0, 0, 8192);
+
+	uint32_t remaining = SAMPLE_RATE;
+	while (remaining) {
+		if (computeAudioSamples() < 0) break;
+
+		uint32_t len = getSoundBufferLen();
+		remaining -= len > remaining ? remaining : len;
+	}
+	printf("%s: digi %s (%d Hz)\n", filename, getDigiTypeDesc(), getDigiRate());
+
+	for (uint32_t p= 0; p<sizeof(_pairs)/sizeof(_pairs[0]); p++) {
+		const RegPair &pair = _pairs[p];
+
+		double t = now();
+		for (uint32_t i= 0; i<(writes >> 1); i++) {
+			setRegisterSID(pair.reg0, i);
+			setRegisterSID(pair.reg1, i >> 3);
+		}
+		printf("  %s: %.1f ns per write\n", pair.name, (now() - t) / (writes & ~1));
+	}
+}
+
+int main(int argc, char** argv) {
+	if (argc < 3) {
+		fprintf(stderr, "usage: %s <writes> <music file>...\n", argv[0]);
+		return 1;
+	}
+	uint32_t writes = atoi(argv[1]);
+	if (writes < 2) writes = 2;
+
+	for (int i= 2; i<argc; i++) {
+		benchFile(argv[i], writes);
+	}
+	return 0;
+}